@@ -0,0 +1,115 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/miniconda/share/cmake/nlohmann_json/nlohmann_jsonConfig.cmake"
+  "/root/miniconda/share/cmake/nlohmann_json/nlohmann_jsonConfigVersion.cmake"
+  "/root/miniconda/share/cmake/nlohmann_json/nlohmann_jsonTargets.cmake"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/memsim-config.cmake.in"
+  "/root/repo/examples/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/benchmarks/CMakeLists.txt"
+  "/tmp/catch2v3/CMakeLists.txt"
+  "/usr/lib/cmake/Catch2/Catch.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkTargets-none.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMajorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FetchContent.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "memsim-config-version.cmake"
+  "memsim-config.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "DartConfiguration.tcl"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/catch2-build/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/benchmarks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/memsim.dir/DependInfo.cmake"
+  "tests/CMakeFiles/memsim_tests.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "_deps/catch2-build/CMakeFiles/Catch2WithMainShim.dir/DependInfo.cmake"
+  "tests/benchmarks/CMakeFiles/memsim_benchmarks.dir/DependInfo.cmake"
+  "tests/benchmarks/CMakeFiles/memsim_perf_regression.dir/DependInfo.cmake"
+  "examples/CMakeFiles/simple_simulation.dir/DependInfo.cmake"
+  "examples/CMakeFiles/multi_fidelity.dir/DependInfo.cmake"
+  "examples/CMakeFiles/tiling_sweep.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/frontend/cache.cpp" "CMakeFiles/memsim.dir/src/frontend/cache.cpp.o" "gcc" "CMakeFiles/memsim.dir/src/frontend/cache.cpp.o.d"
+  "/root/repo/src/frontend/prefetcher.cpp" "CMakeFiles/memsim.dir/src/frontend/prefetcher.cpp.o" "gcc" "CMakeFiles/memsim.dir/src/frontend/prefetcher.cpp.o.d"
+  "/root/repo/src/technology/gddr7_controller.cpp" "CMakeFiles/memsim.dir/src/technology/gddr7_controller.cpp.o" "gcc" "CMakeFiles/memsim.dir/src/technology/gddr7_controller.cpp.o.d"
+  "/root/repo/src/technology/hbm3_controller.cpp" "CMakeFiles/memsim.dir/src/technology/hbm3_controller.cpp.o" "gcc" "CMakeFiles/memsim.dir/src/technology/hbm3_controller.cpp.o.d"
+  "/root/repo/src/technology/lpddr5_controller.cpp" "CMakeFiles/memsim.dir/src/technology/lpddr5_controller.cpp.o" "gcc" "CMakeFiles/memsim.dir/src/technology/lpddr5_controller.cpp.o.d"
+  "/root/repo/src/util/json_config.cpp" "CMakeFiles/memsim.dir/src/util/json_config.cpp.o" "gcc" "CMakeFiles/memsim.dir/src/util/json_config.cpp.o.d"
+  "/root/repo/src/util/trace.cpp" "CMakeFiles/memsim.dir/src/util/trace.cpp.o" "gcc" "CMakeFiles/memsim.dir/src/util/trace.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
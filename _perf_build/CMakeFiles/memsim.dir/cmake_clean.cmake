@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/memsim.dir/src/frontend/cache.cpp.o"
+  "CMakeFiles/memsim.dir/src/frontend/cache.cpp.o.d"
+  "CMakeFiles/memsim.dir/src/frontend/prefetcher.cpp.o"
+  "CMakeFiles/memsim.dir/src/frontend/prefetcher.cpp.o.d"
+  "CMakeFiles/memsim.dir/src/technology/gddr7_controller.cpp.o"
+  "CMakeFiles/memsim.dir/src/technology/gddr7_controller.cpp.o.d"
+  "CMakeFiles/memsim.dir/src/technology/hbm3_controller.cpp.o"
+  "CMakeFiles/memsim.dir/src/technology/hbm3_controller.cpp.o.d"
+  "CMakeFiles/memsim.dir/src/technology/lpddr5_controller.cpp.o"
+  "CMakeFiles/memsim.dir/src/technology/lpddr5_controller.cpp.o.d"
+  "CMakeFiles/memsim.dir/src/util/json_config.cpp.o"
+  "CMakeFiles/memsim.dir/src/util/json_config.cpp.o.d"
+  "CMakeFiles/memsim.dir/src/util/trace.cpp.o"
+  "CMakeFiles/memsim.dir/src/util/trace.cpp.o.d"
+  "libmemsim.a"
+  "libmemsim.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/memsim.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Catch2WithMainShim.dir/main.cpp.o"
+  "CMakeFiles/Catch2WithMainShim.dir/main.cpp.o.d"
+  "libCatch2WithMainShim.a"
+  "libCatch2WithMainShim.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Catch2WithMainShim.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
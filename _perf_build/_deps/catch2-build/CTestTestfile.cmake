@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /tmp/catch2v3
+# Build directory: /root/repo/_perf_build/_deps/catch2-build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/multi_fidelity.dir/multi_fidelity.cpp.o"
+  "CMakeFiles/multi_fidelity.dir/multi_fidelity.cpp.o.d"
+  "multi_fidelity"
+  "multi_fidelity.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/multi_fidelity.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
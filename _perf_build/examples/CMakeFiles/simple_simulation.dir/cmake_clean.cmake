@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simple_simulation.dir/simple_simulation.cpp.o"
+  "CMakeFiles/simple_simulation.dir/simple_simulation.cpp.o.d"
+  "simple_simulation"
+  "simple_simulation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simple_simulation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
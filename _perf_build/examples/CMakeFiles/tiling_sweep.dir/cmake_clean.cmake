@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tiling_sweep.dir/tiling_sweep.cpp.o"
+  "CMakeFiles/tiling_sweep.dir/tiling_sweep.cpp.o.d"
+  "tiling_sweep"
+  "tiling_sweep.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tiling_sweep.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
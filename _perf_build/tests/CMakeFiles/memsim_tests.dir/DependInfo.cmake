@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/unit/test_controller.cpp" "tests/CMakeFiles/memsim_tests.dir/unit/test_controller.cpp.o" "gcc" "tests/CMakeFiles/memsim_tests.dir/unit/test_controller.cpp.o.d"
+  "/root/repo/tests/unit/test_frontend.cpp" "tests/CMakeFiles/memsim_tests.dir/unit/test_frontend.cpp.o" "gcc" "tests/CMakeFiles/memsim_tests.dir/unit/test_frontend.cpp.o.d"
+  "/root/repo/tests/unit/test_kernel.cpp" "tests/CMakeFiles/memsim_tests.dir/unit/test_kernel.cpp.o" "gcc" "tests/CMakeFiles/memsim_tests.dir/unit/test_kernel.cpp.o.d"
+  "/root/repo/tests/unit/test_kpu_adapter.cpp" "tests/CMakeFiles/memsim_tests.dir/unit/test_kpu_adapter.cpp.o" "gcc" "tests/CMakeFiles/memsim_tests.dir/unit/test_kpu_adapter.cpp.o.d"
+  "/root/repo/tests/unit/test_scheduler.cpp" "tests/CMakeFiles/memsim_tests.dir/unit/test_scheduler.cpp.o" "gcc" "tests/CMakeFiles/memsim_tests.dir/unit/test_scheduler.cpp.o.d"
+  "/root/repo/tests/unit/test_system.cpp" "tests/CMakeFiles/memsim_tests.dir/unit/test_system.cpp.o" "gcc" "tests/CMakeFiles/memsim_tests.dir/unit/test_system.cpp.o.d"
+  "/root/repo/tests/unit/test_types.cpp" "tests/CMakeFiles/memsim_tests.dir/unit/test_types.cpp.o" "gcc" "tests/CMakeFiles/memsim_tests.dir/unit/test_types.cpp.o.d"
+  "/root/repo/tests/unit/test_workload.cpp" "tests/CMakeFiles/memsim_tests.dir/unit/test_workload.cpp.o" "gcc" "tests/CMakeFiles/memsim_tests.dir/unit/test_workload.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_perf_build/CMakeFiles/memsim.dir/DependInfo.cmake"
+  "/root/repo/_perf_build/_deps/catch2-build/CMakeFiles/Catch2WithMainShim.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,26 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/memsim_tests.dir/unit/test_controller.cpp.o"
+  "CMakeFiles/memsim_tests.dir/unit/test_controller.cpp.o.d"
+  "CMakeFiles/memsim_tests.dir/unit/test_frontend.cpp.o"
+  "CMakeFiles/memsim_tests.dir/unit/test_frontend.cpp.o.d"
+  "CMakeFiles/memsim_tests.dir/unit/test_kernel.cpp.o"
+  "CMakeFiles/memsim_tests.dir/unit/test_kernel.cpp.o.d"
+  "CMakeFiles/memsim_tests.dir/unit/test_kpu_adapter.cpp.o"
+  "CMakeFiles/memsim_tests.dir/unit/test_kpu_adapter.cpp.o.d"
+  "CMakeFiles/memsim_tests.dir/unit/test_scheduler.cpp.o"
+  "CMakeFiles/memsim_tests.dir/unit/test_scheduler.cpp.o.d"
+  "CMakeFiles/memsim_tests.dir/unit/test_system.cpp.o"
+  "CMakeFiles/memsim_tests.dir/unit/test_system.cpp.o.d"
+  "CMakeFiles/memsim_tests.dir/unit/test_types.cpp.o"
+  "CMakeFiles/memsim_tests.dir/unit/test_types.cpp.o.d"
+  "CMakeFiles/memsim_tests.dir/unit/test_workload.cpp.o"
+  "CMakeFiles/memsim_tests.dir/unit/test_workload.cpp.o.d"
+  "memsim_tests"
+  "memsim_tests.pdb"
+  "memsim_tests_tests-b12d07c.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/memsim_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
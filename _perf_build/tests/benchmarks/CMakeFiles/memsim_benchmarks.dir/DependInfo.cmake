@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/benchmarks/bench_controller.cpp" "tests/benchmarks/CMakeFiles/memsim_benchmarks.dir/bench_controller.cpp.o" "gcc" "tests/benchmarks/CMakeFiles/memsim_benchmarks.dir/bench_controller.cpp.o.d"
+  "/root/repo/tests/benchmarks/bench_scheduler.cpp" "tests/benchmarks/CMakeFiles/memsim_benchmarks.dir/bench_scheduler.cpp.o" "gcc" "tests/benchmarks/CMakeFiles/memsim_benchmarks.dir/bench_scheduler.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_perf_build/CMakeFiles/memsim.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/memsim_benchmarks.dir/bench_controller.cpp.o"
+  "CMakeFiles/memsim_benchmarks.dir/bench_controller.cpp.o.d"
+  "CMakeFiles/memsim_benchmarks.dir/bench_scheduler.cpp.o"
+  "CMakeFiles/memsim_benchmarks.dir/bench_scheduler.cpp.o.d"
+  "memsim_benchmarks"
+  "memsim_benchmarks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/memsim_benchmarks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/memsim_perf_regression.dir/perf_regression.cpp.o"
+  "CMakeFiles/memsim_perf_regression.dir/perf_regression.cpp.o.d"
+  "memsim_perf_regression"
+  "memsim_perf_regression.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/memsim_perf_regression.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
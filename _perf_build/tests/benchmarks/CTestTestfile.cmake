@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/benchmarks
+# Build directory: /root/repo/_perf_build/tests/benchmarks
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[perf_speedup]=] "/root/repo/_perf_build/tests/benchmarks/memsim_perf_regression" "--speedup-only" "--tolerance" "0.5" "--baseline" "/root/repo/tests/benchmarks/perf_baseline.json")
+set_tests_properties([=[perf_speedup]=] PROPERTIES  LABELS "perf" RUN_SERIAL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/benchmarks/CMakeLists.txt;34;add_test;/root/repo/tests/benchmarks/CMakeLists.txt;0;")
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_perf_build/tests/memsim_tests_tests-b12d07c.cmake")
+  include("/root/repo/_perf_build/tests/memsim_tests_tests-b12d07c.cmake")
+else()
+  add_test(memsim_tests_NOT_BUILT-b12d07c memsim_tests_NOT_BUILT-b12d07c)
+endif()
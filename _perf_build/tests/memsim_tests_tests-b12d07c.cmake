@@ -0,0 +1,167 @@
+add_test( [==[Fidelity enum to_string]==] /root/repo/_perf_build/tests/memsim_tests [==[Fidelity enum to_string]==]  )
+set_tests_properties( [==[Fidelity enum to_string]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Technology enum to_string]==] /root/repo/_perf_build/tests/memsim_tests [==[Technology enum to_string]==]  )
+set_tests_properties( [==[Technology enum to_string]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[BankState enum to_string]==] /root/repo/_perf_build/tests/memsim_tests [==[BankState enum to_string]==]  )
+set_tests_properties( [==[BankState enum to_string]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Statistics default values]==] /root/repo/_perf_build/tests/memsim_tests [==[Statistics default values]==]  )
+set_tests_properties( [==[Statistics default values]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Statistics record_request]==] /root/repo/_perf_build/tests/memsim_tests [==[Statistics record_request]==]  )
+set_tests_properties( [==[Statistics record_request]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Timing presets]==] /root/repo/_perf_build/tests/memsim_tests [==[Timing presets]==]  )
+set_tests_properties( [==[Timing presets]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[OrganizationParams derived values]==] /root/repo/_perf_build/tests/memsim_tests [==[OrganizationParams derived values]==]  )
+set_tests_properties( [==[OrganizationParams derived values]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[ControllerConfig clock calculations]==] /root/repo/_perf_build/tests/memsim_tests [==[ControllerConfig clock calculations]==]  )
+set_tests_properties( [==[ControllerConfig clock calculations]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Clock domains convert cycles exactly]==] /root/repo/_perf_build/tests/memsim_tests [==[Clock domains convert cycles exactly]==]  )
+set_tests_properties( [==[Clock domains convert cycles exactly]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Cycle-accurate controller completes all requests]==] /root/repo/_perf_build/tests/memsim_tests [==[Cycle-accurate controller completes all requests]==]  )
+set_tests_properties( [==[Cycle-accurate controller completes all requests]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Split requests count once while pending]==] /root/repo/_perf_build/tests/memsim_tests [==[Split requests count once while pending]==]  )
+set_tests_properties( [==[Split requests count once while pending]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Cycle-accurate controller scales past 256 banks]==] /root/repo/_perf_build/tests/memsim_tests [==[Cycle-accurate controller scales past 256 banks]==]  )
+set_tests_properties( [==[Cycle-accurate controller scales past 256 banks]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Channels with more than 256 banks are addressable]==] /root/repo/_perf_build/tests/memsim_tests [==[Channels with more than 256 banks are addressable]==]  )
+set_tests_properties( [==[Channels with more than 256 banks are addressable]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Bank array completes transient states at their expiry]==] /root/repo/_perf_build/tests/memsim_tests [==[Bank array completes transient states at their expiry]==]  )
+set_tests_properties( [==[Bank array completes transient states at their expiry]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Channels have their own buses and run in parallel]==] /root/repo/_perf_build/tests/memsim_tests [==[Channels have their own buses and run in parallel]==]  )
+set_tests_properties( [==[Channels have their own buses and run in parallel]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Ranks have their own banks and share the data bus]==] /root/repo/_perf_build/tests/memsim_tests [==[Ranks have their own banks and share the data bus]==]  )
+set_tests_properties( [==[Ranks have their own banks and share the data bus]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Ranks refresh in turn when refresh is enabled]==] /root/repo/_perf_build/tests/memsim_tests [==[Ranks refresh in turn when refresh is enabled]==]  )
+set_tests_properties( [==[Ranks refresh in turn when refresh is enabled]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Open page policy keeps rows open for streaming]==] /root/repo/_perf_build/tests/memsim_tests [==[Open page policy keeps rows open for streaming]==]  )
+set_tests_properties( [==[Open page policy keeps rows open for streaming]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Closed page policy auto-precharges every access]==] /root/repo/_perf_build/tests/memsim_tests [==[Closed page policy auto-precharges every access]==]  )
+set_tests_properties( [==[Closed page policy auto-precharges every access]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Closed page avoids conflicts on row thrashing]==] /root/repo/_perf_build/tests/memsim_tests [==[Closed page avoids conflicts on row thrashing]==]  )
+set_tests_properties( [==[Closed page avoids conflicts on row thrashing]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Adaptive page policies follow pending row hits]==] /root/repo/_perf_build/tests/memsim_tests [==[Adaptive page policies follow pending row hits]==]  )
+set_tests_properties( [==[Adaptive page policies follow pending row hits]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Row hit streak cap bounds conflicting request latency]==] /root/repo/_perf_build/tests/memsim_tests [==[Row hit streak cap bounds conflicting request latency]==]  )
+set_tests_properties( [==[Row hit streak cap bounds conflicting request latency]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Write buffer coalesces writes to the same burst]==] /root/repo/_perf_build/tests/memsim_tests [==[Write buffer coalesces writes to the same burst]==]  )
+set_tests_properties( [==[Write buffer coalesces writes to the same burst]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Write buffer forwards reads to pending writes]==] /root/repo/_perf_build/tests/memsim_tests [==[Write buffer forwards reads to pending writes]==]  )
+set_tests_properties( [==[Write buffer forwards reads to pending writes]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Posted writes stay out of min latency and back-pressure admission]==] /root/repo/_perf_build/tests/memsim_tests [==[Posted writes stay out of min latency and back-pressure admission]==]  )
+set_tests_properties( [==[Posted writes stay out of min latency and back-pressure admission]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Write buffer drains under read pressure]==] /root/repo/_perf_build/tests/memsim_tests [==[Write buffer drains under read pressure]==]  )
+set_tests_properties( [==[Write buffer drains under read pressure]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Large requests are split into burst-sized accesses]==] /root/repo/_perf_build/tests/memsim_tests [==[Large requests are split into burst-sized accesses]==]  )
+set_tests_properties( [==[Large requests are split into burst-sized accesses]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Unaligned requests touch every overlapped burst]==] /root/repo/_perf_build/tests/memsim_tests [==[Unaligned requests touch every overlapped burst]==]  )
+set_tests_properties( [==[Unaligned requests touch every overlapped burst]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Checkpoint restores a cycle-accurate controller mid-flight]==] /root/repo/_perf_build/tests/memsim_tests [==[Checkpoint restores a cycle-accurate controller mid-flight]==]  )
+set_tests_properties( [==[Checkpoint restores a cycle-accurate controller mid-flight]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Checkpoint preserves transactional RNG state]==] /root/repo/_perf_build/tests/memsim_tests [==[Checkpoint preserves transactional RNG state]==]  )
+set_tests_properties( [==[Checkpoint preserves transactional RNG state]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Checkpoint rejects mismatched or truncated data]==] /root/repo/_perf_build/tests/memsim_tests [==[Checkpoint rejects mismatched or truncated data]==]  )
+set_tests_properties( [==[Checkpoint rejects mismatched or truncated data]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Cloned controller continues identically]==] /root/repo/_perf_build/tests/memsim_tests [==[Cloned controller continues identically]==]  )
+set_tests_properties( [==[Cloned controller continues identically]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Cloned branches evolve independently]==] /root/repo/_perf_build/tests/memsim_tests [==[Cloned branches evolve independently]==]  )
+set_tests_properties( [==[Cloned branches evolve independently]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Factory binds the configured scheduler policy]==] /root/repo/_perf_build/tests/memsim_tests [==[Factory binds the configured scheduler policy]==]  )
+set_tests_properties( [==[Factory binds the configured scheduler policy]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Sampling controller estimates detailed metrics]==] /root/repo/_perf_build/tests/memsim_tests [==[Sampling controller estimates detailed metrics]==]  )
+set_tests_properties( [==[Sampling controller estimates detailed metrics]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Sampling controller validates its schedule]==] /root/repo/_perf_build/tests/memsim_tests [==[Sampling controller validates its schedule]==]  )
+set_tests_properties( [==[Sampling controller validates its schedule]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[FR-FCFS prefers row hits]==] /root/repo/_perf_build/tests/memsim_tests [==[FR-FCFS prefers row hits]==]  )
+set_tests_properties( [==[FR-FCFS prefers row hits]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[FR-FCFS serves low-priority prefetches after demands]==] /root/repo/_perf_build/tests/memsim_tests [==[FR-FCFS serves low-priority prefetches after demands]==]  )
+set_tests_properties( [==[FR-FCFS serves low-priority prefetches after demands]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[FR-FCFS-GRP and FIFO serve low-priority prefetches after demands]==] /root/repo/_perf_build/tests/memsim_tests [==[FR-FCFS-GRP and FIFO serve low-priority prefetches after demands]==]  )
+set_tests_properties( [==[FR-FCFS-GRP and FIFO serve low-priority prefetches after demands]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[FR-FCFS row hit streak cap]==] /root/repo/_perf_build/tests/memsim_tests [==[FR-FCFS row hit streak cap]==]  )
+set_tests_properties( [==[FR-FCFS row hit streak cap]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[FR-FCFS streak cap falls back to hits when no other row waits]==] /root/repo/_perf_build/tests/memsim_tests [==[FR-FCFS streak cap falls back to hits when no other row waits]==]  )
+set_tests_properties( [==[FR-FCFS streak cap falls back to hits when no other row waits]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[FR-FCFS age threshold forces oldest request]==] /root/repo/_perf_build/tests/memsim_tests [==[FR-FCFS age threshold forces oldest request]==]  )
+set_tests_properties( [==[FR-FCFS age threshold forces oldest request]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[FR-FCFS-GRP applies the same starvation limits]==] /root/repo/_perf_build/tests/memsim_tests [==[FR-FCFS-GRP applies the same starvation limits]==]  )
+set_tests_properties( [==[FR-FCFS-GRP applies the same starvation limits]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[FIFO serves demands in arrival order]==] /root/repo/_perf_build/tests/memsim_tests [==[FIFO serves demands in arrival order]==]  )
+set_tests_properties( [==[FIFO serves demands in arrival order]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[FR-FCFS streak cap holds while the bank is precharged]==] /root/repo/_perf_build/tests/memsim_tests [==[FR-FCFS streak cap holds while the bank is precharged]==]  )
+set_tests_properties( [==[FR-FCFS streak cap holds while the bank is precharged]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Scheduler restore rejects corrupt request references]==] /root/repo/_perf_build/tests/memsim_tests [==[Scheduler restore rejects corrupt request references]==]  )
+set_tests_properties( [==[Scheduler restore rejects corrupt request references]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Pool restore rejects corrupt free lists]==] /root/repo/_perf_build/tests/memsim_tests [==[Pool restore rejects corrupt free lists]==]  )
+set_tests_properties( [==[Pool restore rejects corrupt free lists]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Tag array finds lines and picks LRU victims]==] /root/repo/_perf_build/tests/memsim_tests [==[Tag array finds lines and picks LRU victims]==]  )
+set_tests_properties( [==[Tag array finds lines and picks LRU victims]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Cache hits avoid memory traffic]==] /root/repo/_perf_build/tests/memsim_tests [==[Cache hits avoid memory traffic]==]  )
+set_tests_properties( [==[Cache hits avoid memory traffic]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Cache merges concurrent misses in MSHRs]==] /root/repo/_perf_build/tests/memsim_tests [==[Cache merges concurrent misses in MSHRs]==]  )
+set_tests_properties( [==[Cache merges concurrent misses in MSHRs]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Write-back cache writes dirty victims on eviction]==] /root/repo/_perf_build/tests/memsim_tests [==[Write-back cache writes dirty victims on eviction]==]  )
+set_tests_properties( [==[Write-back cache writes dirty victims on eviction]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Write-through no-allocate cache forwards every write]==] /root/repo/_perf_build/tests/memsim_tests [==[Write-through no-allocate cache forwards every write]==]  )
+set_tests_properties( [==[Write-through no-allocate cache forwards every write]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Cache splits multi-line requests]==] /root/repo/_perf_build/tests/memsim_tests [==[Cache splits multi-line requests]==]  )
+set_tests_properties( [==[Cache splits multi-line requests]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Read merger fans out duplicate reads]==] /root/repo/_perf_build/tests/memsim_tests [==[Read merger fans out duplicate reads]==]  )
+set_tests_properties( [==[Read merger fans out duplicate reads]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Read merger does not merge across writes]==] /root/repo/_perf_build/tests/memsim_tests [==[Read merger does not merge across writes]==]  )
+set_tests_properties( [==[Read merger does not merge across writes]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Read merger works over behavioral controllers]==] /root/repo/_perf_build/tests/memsim_tests [==[Read merger works over behavioral controllers]==]  )
+set_tests_properties( [==[Read merger works over behavioral controllers]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Prefetcher covers a sequential stream]==] /root/repo/_perf_build/tests/memsim_tests [==[Prefetcher covers a sequential stream]==]  )
+set_tests_properties( [==[Prefetcher covers a sequential stream]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Prefetcher detects strides per source]==] /root/repo/_perf_build/tests/memsim_tests [==[Prefetcher detects strides per source]==]  )
+set_tests_properties( [==[Prefetcher detects strides per source]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Prefetcher stays quiet on random traffic]==] /root/repo/_perf_build/tests/memsim_tests [==[Prefetcher stays quiet on random traffic]==]  )
+set_tests_properties( [==[Prefetcher stays quiet on random traffic]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Writes invalidate prefetched lines]==] /root/repo/_perf_build/tests/memsim_tests [==[Writes invalidate prefetched lines]==]  )
+set_tests_properties( [==[Writes invalidate prefetched lines]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Reads after a write do not wait on an in-flight prefetch]==] /root/repo/_perf_build/tests/memsim_tests [==[Reads after a write do not wait on an in-flight prefetch]==]  )
+set_tests_properties( [==[Reads after a write do not wait on an in-flight prefetch]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Clock crossing reports timing in requester cycles]==] /root/repo/_perf_build/tests/memsim_tests [==[Clock crossing reports timing in requester cycles]==]  )
+set_tests_properties( [==[Clock crossing reports timing in requester cycles]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Sequential and strided generators wrap at the footprint]==] /root/repo/_perf_build/tests/memsim_tests [==[Sequential and strided generators wrap at the footprint]==]  )
+set_tests_properties( [==[Sequential and strided generators wrap at the footprint]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Random and Zipfian generators are reproducible]==] /root/repo/_perf_build/tests/memsim_tests [==[Random and Zipfian generators are reproducible]==]  )
+set_tests_properties( [==[Random and Zipfian generators are reproducible]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Tensor walks follow tile and im2col order]==] /root/repo/_perf_build/tests/memsim_tests [==[Tensor walks follow tile and im2col order]==]  )
+set_tests_properties( [==[Tensor walks follow tile and im2col order]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Generators apply read ratio and arrival processes]==] /root/repo/_perf_build/tests/memsim_tests [==[Generators apply read ratio and arrival processes]==]  )
+set_tests_properties( [==[Generators apply read ratio and arrival processes]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Stream mix merges in arrival order and drives a controller]==] /root/repo/_perf_build/tests/memsim_tests [==[Stream mix merges in arrival order and drives a controller]==]  )
+set_tests_properties( [==[Stream mix merges in arrival order and drives a controller]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Tensor operator traffic follows the dataflow]==] /root/repo/_perf_build/tests/memsim_tests [==[Tensor operator traffic follows the dataflow]==]  )
+set_tests_properties( [==[Tensor operator traffic follows the dataflow]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Convolution layers fetch the input tensor without padding]==] /root/repo/_perf_build/tests/memsim_tests [==[Convolution layers fetch the input tensor without padding]==]  )
+set_tests_properties( [==[Convolution layers fetch the input tensor without padding]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Coroutine agents drive a cycle-accurate controller]==] /root/repo/_perf_build/tests/memsim_tests [==[Coroutine agents drive a cycle-accurate controller]==]  )
+set_tests_properties( [==[Coroutine agents drive a cycle-accurate controller]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Agent delays and fixed latencies advance simulated time]==] /root/repo/_perf_build/tests/memsim_tests [==[Agent delays and fixed latencies advance simulated time]==]  )
+set_tests_properties( [==[Agent delays and fixed latencies advance simulated time]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Agent frames are pooled and errors propagate]==] /root/repo/_perf_build/tests/memsim_tests [==[Agent frames are pooled and errors propagate]==]  )
+set_tests_properties( [==[Agent frames are pooled and errors propagate]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Event kernel orders events by cycle, then by scheduling]==] /root/repo/_perf_build/tests/memsim_tests [==[Event kernel orders events by cycle\, then by scheduling]==]  )
+set_tests_properties( [==[Event kernel orders events by cycle, then by scheduling]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Event kernel wakes components only when due]==] /root/repo/_perf_build/tests/memsim_tests [==[Event kernel wakes components only when due]==]  )
+set_tests_properties( [==[Event kernel wakes components only when due]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Controllers and agents share one event kernel]==] /root/repo/_perf_build/tests/memsim_tests [==[Controllers and agents share one event kernel]==]  )
+set_tests_properties( [==[Controllers and agents share one event kernel]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[kpu adapter reports fixed latencies in requester cycles]==] /root/repo/_perf_build/tests/memsim_tests [==[kpu adapter reports fixed latencies in requester cycles]==]  )
+set_tests_properties( [==[kpu adapter reports fixed latencies in requester cycles]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[kpu adapter submits batches until back-pressure]==] /root/repo/_perf_build/tests/memsim_tests [==[kpu adapter submits batches until back-pressure]==]  )
+set_tests_properties( [==[kpu adapter submits batches until back-pressure]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[kpu adapter calls concrete controllers directly]==] /root/repo/_perf_build/tests/memsim_tests [==[kpu adapter calls concrete controllers directly]==]  )
+set_tests_properties( [==[kpu adapter calls concrete controllers directly]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Address map interleaves regions across controllers]==] /root/repo/_perf_build/tests/memsim_tests [==[Address map interleaves regions across controllers]==]  )
+set_tests_properties( [==[Address map interleaves regions across controllers]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Memory system routes requests and merges statistics]==] /root/repo/_perf_build/tests/memsim_tests [==[Memory system routes requests and merges statistics]==]  )
+set_tests_properties( [==[Memory system routes requests and merges statistics]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Interconnect adds link latency and serialization to far accesses]==] /root/repo/_perf_build/tests/memsim_tests [==[Interconnect adds link latency and serialization to far accesses]==]  )
+set_tests_properties( [==[Interconnect adds link latency and serialization to far accesses]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Interconnect counts memory latency once for deferred completions]==] /root/repo/_perf_build/tests/memsim_tests [==[Interconnect counts memory latency once for deferred completions]==]  )
+set_tests_properties( [==[Interconnect counts memory latency once for deferred completions]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+add_test( [==[Interconnect credits and bandwidth throttle far traffic]==] /root/repo/_perf_build/tests/memsim_tests [==[Interconnect credits and bandwidth throttle far traffic]==]  )
+set_tests_properties( [==[Interconnect credits and bandwidth throttle far traffic]==] PROPERTIES WORKING_DIRECTORY /root/repo/_perf_build/tests)
+set( memsim_tests_TESTS [==[Fidelity enum to_string]==] [==[Technology enum to_string]==] [==[BankState enum to_string]==] [==[Statistics default values]==] [==[Statistics record_request]==] [==[Timing presets]==] [==[OrganizationParams derived values]==] [==[ControllerConfig clock calculations]==] [==[Clock domains convert cycles exactly]==] [==[Cycle-accurate controller completes all requests]==] [==[Split requests count once while pending]==] [==[Cycle-accurate controller scales past 256 banks]==] [==[Channels with more than 256 banks are addressable]==] [==[Bank array completes transient states at their expiry]==] [==[Channels have their own buses and run in parallel]==] [==[Ranks have their own banks and share the data bus]==] [==[Ranks refresh in turn when refresh is enabled]==] [==[Open page policy keeps rows open for streaming]==] [==[Closed page policy auto-precharges every access]==] [==[Closed page avoids conflicts on row thrashing]==] [==[Adaptive page policies follow pending row hits]==] [==[Row hit streak cap bounds conflicting request latency]==] [==[Write buffer coalesces writes to the same burst]==] [==[Write buffer forwards reads to pending writes]==] [==[Posted writes stay out of min latency and back-pressure admission]==] [==[Write buffer drains under read pressure]==] [==[Large requests are split into burst-sized accesses]==] [==[Unaligned requests touch every overlapped burst]==] [==[Checkpoint restores a cycle-accurate controller mid-flight]==] [==[Checkpoint preserves transactional RNG state]==] [==[Checkpoint rejects mismatched or truncated data]==] [==[Cloned controller continues identically]==] [==[Cloned branches evolve independently]==] [==[Factory binds the configured scheduler policy]==] [==[Sampling controller estimates detailed metrics]==] [==[Sampling controller validates its schedule]==] [==[FR-FCFS prefers row hits]==] [==[FR-FCFS serves low-priority prefetches after demands]==] [==[FR-FCFS-GRP and FIFO serve low-priority prefetches after demands]==] [==[FR-FCFS row hit streak cap]==] [==[FR-FCFS streak cap falls back to hits when no other row waits]==] [==[FR-FCFS age threshold forces oldest request]==] [==[FR-FCFS-GRP applies the same starvation limits]==] [==[FIFO serves demands in arrival order]==] [==[FR-FCFS streak cap holds while the bank is precharged]==] [==[Scheduler restore rejects corrupt request references]==] [==[Pool restore rejects corrupt free lists]==] [==[Tag array finds lines and picks LRU victims]==] [==[Cache hits avoid memory traffic]==] [==[Cache merges concurrent misses in MSHRs]==] [==[Write-back cache writes dirty victims on eviction]==] [==[Write-through no-allocate cache forwards every write]==] [==[Cache splits multi-line requests]==] [==[Read merger fans out duplicate reads]==] [==[Read merger does not merge across writes]==] [==[Read merger works over behavioral controllers]==] [==[Prefetcher covers a sequential stream]==] [==[Prefetcher detects strides per source]==] [==[Prefetcher stays quiet on random traffic]==] [==[Writes invalidate prefetched lines]==] [==[Reads after a write do not wait on an in-flight prefetch]==] [==[Clock crossing reports timing in requester cycles]==] [==[Sequential and strided generators wrap at the footprint]==] [==[Random and Zipfian generators are reproducible]==] [==[Tensor walks follow tile and im2col order]==] [==[Generators apply read ratio and arrival processes]==] [==[Stream mix merges in arrival order and drives a controller]==] [==[Tensor operator traffic follows the dataflow]==] [==[Convolution layers fetch the input tensor without padding]==] [==[Coroutine agents drive a cycle-accurate controller]==] [==[Agent delays and fixed latencies advance simulated time]==] [==[Agent frames are pooled and errors propagate]==] [==[Event kernel orders events by cycle, then by scheduling]==] [==[Event kernel wakes components only when due]==] [==[Controllers and agents share one event kernel]==] [==[kpu adapter reports fixed latencies in requester cycles]==] [==[kpu adapter submits batches until back-pressure]==] [==[kpu adapter calls concrete controllers directly]==] [==[Address map interleaves regions across controllers]==] [==[Memory system routes requests and merges statistics]==] [==[Interconnect adds link latency and serialization to far accesses]==] [==[Interconnect counts memory latency once for deferred completions]==] [==[Interconnect credits and bandwidth throttle far traffic]==])
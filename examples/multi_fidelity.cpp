@@ -1,5 +1,6 @@
 #include <sw/memsim/memsim.hpp>
 #include <sw/memsim/technology/lpddr5/lpddr5_controller.hpp>
+#include <sw/memsim/workload/generator.hpp>
 
 #include <iostream>
 #include <iomanip>
@@ -11,15 +12,15 @@ using namespace sw::memsim;
 void run_benchmark(IMemoryController& controller, int num_requests, const std::string& name) {
     auto start = std::chrono::high_resolution_clock::now();
 
+    // Sequential 64-byte accesses over a 64 KB region, half of them writes
+    workload::GeneratorConfig traffic;
+    traffic.footprint = 1000 * 64;
+    traffic.size = 64;
+    traffic.read_ratio = 0.5;
+    workload::SequentialGenerator generator(traffic);
+
     // Submit requests
-    for (int i = 0; i < num_requests; ++i) {
-        uint64_t addr = (i % 1000) * 64;  // Mix of row hits and misses
-        if (i % 2 == 0) {
-            controller.read(addr, 64);
-        } else {
-            controller.write(addr, 64);
-        }
-    }
+    workload::drive(controller, generator, num_requests);
 
     // Drain pending requests
     controller.drain();
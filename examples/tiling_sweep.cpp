@@ -0,0 +1,46 @@
+#include <sw/memsim/memsim.hpp>
+#include <sw/memsim/technology/lpddr5/lpddr5_controller.hpp>
+#include <sw/memsim/workload/tensor_operator.hpp>
+
+#include <iomanip>
+#include <iostream>
+
+using namespace sw::memsim;
+using namespace sw::memsim::workload;
+
+int main() {
+    std::cout << "Stillwater MemSim - GEMM Tiling Sweep on LPDDR5-6400\n";
+    std::cout << "====================================================\n\n";
+
+    const GemmShape gemm{256, 256, 256};
+
+    ControllerConfig config;
+    config.technology = Technology::LPDDR5;
+    config.fidelity = Fidelity::CYCLE_ACCURATE;
+    config.speed_mt_s = 6400;
+    config.timing = timing_presets::lpddr5_6400();
+
+    std::cout << std::setw(20) << "dataflow" << std::setw(6) << "tile"
+              << std::setw(10) << "requests" << std::setw(12) << "MACs/byte"
+              << std::setw(10) << "cycles" << std::setw(10) << "hit rate" << "\n";
+
+    for (Dataflow dataflow : {Dataflow::OUTPUT_STATIONARY, Dataflow::WEIGHT_STATIONARY,
+                              Dataflow::INPUT_STATIONARY}) {
+        for (uint64_t tile : {32, 64, 128}) {
+            TensorOperatorGenerator generator(GeneratorConfig{}, gemm, Tiling{tile, tile, tile, dataflow});
+            OperatorTraffic traffic = generator.pass_traffic();
+            uint64_t requests = traffic.read_requests + traffic.write_requests;
+
+            auto controller = lpddr5::create_lpddr5_controller(config);
+            drive(*controller, generator, requests);
+            controller->drain();
+
+            std::cout << std::setw(20) << to_string(dataflow) << std::setw(6) << tile
+                      << std::setw(10) << requests
+                      << std::setw(12) << std::fixed << std::setprecision(2) << traffic.arithmetic_intensity()
+                      << std::setw(10) << controller->cycle()
+                      << std::setw(9) << std::setprecision(1) << controller->stats().page_hit_rate() * 100 << "%\n";
+        }
+    }
+    return 0;
+}
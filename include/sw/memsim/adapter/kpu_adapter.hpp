@@ -0,0 +1,337 @@
+#pragma once
+
+#include <sw/memsim/core/clock.hpp>
+#include <sw/memsim/interface/memory_controller.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <queue>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+namespace sw::memsim {
+
+// ============================================================================
+// Request Mapping
+// ============================================================================
+
+/// How a kpu-sim request maps onto a memsim request
+///
+/// The primary template reads the members `address`, `size`, `is_write`
+/// and `tag`. Specialize it for request types that name them differently.
+template <typename KpuRequest>
+struct KpuRequestTraits {
+    static Address address(const KpuRequest& r) { return r.address; }
+    static uint32_t size(const KpuRequest& r) { return static_cast<uint32_t>(r.size); }
+    static bool is_write(const KpuRequest& r) { return r.is_write; }
+    static uint64_t tag(const KpuRequest& r) { return r.tag; }
+};
+
+template <typename R>
+concept KpuRequestLike = requires(const R& r) {
+    { KpuRequestTraits<R>::address(r) } -> std::convertible_to<Address>;
+    { KpuRequestTraits<R>::size(r) } -> std::convertible_to<uint32_t>;
+    { KpuRequestTraits<R>::is_write(r) } -> std::convertible_to<bool>;
+    { KpuRequestTraits<R>::tag(r) } -> std::convertible_to<uint64_t>;
+};
+
+/// Response handed back to kpu-sim
+struct KpuCompletion {
+    uint64_t tag = 0;           ///< Tag of the originating request
+    Cycle cycle = 0;            ///< Requester cycle the data is available
+    Cycle latency = 0;          ///< Requester cycles since the request was accepted
+    bool is_write = false;
+};
+
+// ============================================================================
+// kpu-sim Adapter
+// ============================================================================
+
+/// Bridge from kpu-sim's request/response model to a memsim controller
+///
+/// kpu-sim issues tagged requests, advances its own clock and polls for
+/// responses. The adapter builds each memsim Request in place from the
+/// kpu-sim request (no intermediate copy), runs the controller in the
+/// memory clock domain and holds completions until the requester clock
+/// reaches them, so poll() returns responses with correct timing in
+/// requester cycles.
+///
+/// `Controller` selects how the controller is called. With the default
+/// IMemoryController every call is virtual; naming the concrete class
+/// (e.g. lpddr5::CycleAccurateLPDDR5Controller) makes the calls direct.
+/// The controller passed in must then be exactly that class.
+///
+/// A kpu-sim memory interface implementation forwards to this adapter:
+///
+/// ```cpp
+/// class MemSimAdapter : public sw::kpu::IMemoryController {
+///     sw::memsim::KpuAdapter<> memory_;
+/// public:
+///     bool issue(const sw::kpu::MemoryRequest& r) override { return memory_.submit(r); }
+///     void tick() override { memory_.tick(); }
+///     // ...
+/// };
+/// ```
+template <typename Controller = IMemoryController>
+class KpuAdapter {
+    static_assert(std::is_base_of_v<IMemoryController, Controller>,
+                  "Controller must implement IMemoryController");
+
+public:
+    /// @param requester Clock of the kpu-sim component driving the adapter
+    KpuAdapter(const ClockDomain& requester, std::unique_ptr<Controller> controller)
+        : controller_(std::move(controller))
+        , to_memory_(requester.ratio_to(checked(controller_).config().clock()))
+        , to_requester_(to_memory_.inverse())
+        , stepper_(to_memory_)
+    {
+        // Align cycle 0 of both clocks
+        cycle_ = to_requester_.ceil(controller_->cycle());
+        stepper_.seek(cycle_);
+        controller_->set_cycle(to_memory_.floor(cycle_));
+    }
+
+    KpuAdapter(const KpuAdapter&) = delete;
+    KpuAdapter& operator=(const KpuAdapter&) = delete;
+
+    // ========================================================================
+    // Request Interface
+    // ========================================================================
+
+    /// Submit one request at the current requester cycle
+    ///
+    /// @return false if the controller is full (retry on a later cycle)
+    template <KpuRequestLike R>
+    bool submit(const R& request) {
+        using Traits = KpuRequestTraits<R>;
+        const uint32_t slot = acquire_slot();
+        Inflight& inflight = inflight_[slot];
+        inflight.tag = Traits::tag(request);
+        inflight.issued = cycle_;
+        inflight.memory_issued = memory_cycle();
+        inflight.is_write = Traits::is_write(request);
+
+        Request out;
+        out.address = Traits::address(request);
+        out.size = Traits::size(request);
+        out.type = inflight.is_write ? RequestType::WRITE : RequestType::READ;
+        out.callback = [this, slot](Cycle latency) { complete(slot, latency); };
+
+        outstanding_++;     // Fixed-latency controllers complete inside submit
+        if (!call_submit(std::move(out))) {
+            outstanding_--;
+            free_.push_back(slot);
+            return false;
+        }
+        return true;
+    }
+
+    /// Submit requests in order until the controller pushes back
+    ///
+    /// @return Number of requests accepted (a prefix of `batch`)
+    template <KpuRequestLike R>
+    size_t submit(std::span<const R> batch) {
+        size_t accepted = 0;
+        while (accepted < batch.size() && submit(batch[accepted])) {
+            accepted++;
+        }
+        return accepted;
+    }
+
+    template <KpuRequestLike R>
+    size_t submit(const std::vector<R>& batch) {
+        return submit(std::span<const R>(batch));
+    }
+
+    // ========================================================================
+    // Completion Polling
+    // ========================================================================
+
+    /// Move the completions due by the current requester cycle into `out`
+    ///
+    /// Completions are appended in completion order.
+    /// @return Number of completions appended
+    size_t poll(std::vector<KpuCompletion>& out) {
+        size_t count = 0;
+        while (!due_.empty() && due_.top().completion.cycle <= cycle_) {
+            out.push_back(due_.top().completion);
+            due_.pop();
+            count++;
+        }
+        return count;
+    }
+
+    /// Take the next due completion, if any
+    std::optional<KpuCompletion> poll() {
+        if (due_.empty() || due_.top().completion.cycle > cycle_) {
+            return std::nullopt;
+        }
+        KpuCompletion completion = due_.top().completion;
+        due_.pop();
+        return completion;
+    }
+
+    // ========================================================================
+    // Simulation Interface
+    // ========================================================================
+
+    /// Advance one requester cycle
+    void tick() {
+        cycle_++;
+        for (uint64_t edges = stepper_.step(); edges > 0; --edges) {
+            call_tick();
+        }
+    }
+
+    /// Advance `n` requester cycles
+    void tick(Cycle n) {
+        for (Cycle i = 0; i < n; ++i) {
+            tick();
+        }
+    }
+
+    /// Tick until every accepted request is due for poll()
+    void drain() {
+        while (outstanding_ > 0 || call_has_pending()) {
+            tick();
+        }
+        if (latest_due_ > cycle_) {
+            tick(latest_due_ - cycle_);
+        }
+    }
+
+    [[nodiscard]] bool can_accept() const { return call_can_accept(); }
+
+    /// Requests accepted whose completion has not been polled yet
+    [[nodiscard]] size_t in_flight() const { return outstanding_ + due_.size(); }
+    [[nodiscard]] bool idle() const { return in_flight() == 0; }
+
+    /// Current requester cycle
+    [[nodiscard]] Cycle cycle() const { return cycle_; }
+    [[nodiscard]] Cycle memory_cycle() const { return call_cycle(); }
+
+    /// Memory cycles per requester cycle
+    [[nodiscard]] const ClockRatio& ratio() const { return to_memory_; }
+
+    [[nodiscard]] Controller& controller() { return *controller_; }
+    [[nodiscard]] const Controller& controller() const { return *controller_; }
+
+private:
+    struct Inflight {
+        uint64_t tag = 0;
+        Cycle issued = 0;
+        Cycle memory_issued = 0;
+        bool is_write = false;
+    };
+
+    struct Due {
+        KpuCompletion completion;
+        uint64_t seq;
+
+        bool operator>(const Due& other) const {
+            return completion.cycle != other.completion.cycle
+                ? completion.cycle > other.completion.cycle
+                : seq > other.seq;
+        }
+    };
+
+    /// Calls bypass the vtable when Controller is a concrete class
+    static constexpr bool kDirect = !std::is_abstract_v<Controller>;
+
+    static Controller& checked(const std::unique_ptr<Controller>& controller) {
+        if (!controller) {
+            throw std::invalid_argument("kpu adapter needs a controller");
+        }
+        if constexpr (kDirect) {
+            if (typeid(*controller) != typeid(Controller)) {
+                throw std::invalid_argument("controller type differs from the adapter's Controller");
+            }
+        }
+        return *controller;
+    }
+
+    std::optional<RequestId> call_submit(Request request) {
+        if constexpr (kDirect) {
+            return controller_->Controller::submit(std::move(request));
+        } else {
+            return controller_->submit(std::move(request));
+        }
+    }
+
+    void call_tick() {
+        if constexpr (kDirect) {
+            controller_->Controller::tick();
+        } else {
+            controller_->tick();
+        }
+    }
+
+    [[nodiscard]] Cycle call_cycle() const {
+        if constexpr (kDirect) {
+            return controller_->Controller::cycle();
+        } else {
+            return controller_->cycle();
+        }
+    }
+
+    [[nodiscard]] bool call_has_pending() const {
+        if constexpr (kDirect) {
+            return controller_->Controller::has_pending();
+        } else {
+            return controller_->has_pending();
+        }
+    }
+
+    [[nodiscard]] bool call_can_accept() const {
+        if constexpr (kDirect) {
+            return controller_->Controller::can_accept();
+        } else {
+            return controller_->can_accept();
+        }
+    }
+
+    uint32_t acquire_slot() {
+        if (free_.empty()) {
+            inflight_.emplace_back();
+            return static_cast<uint32_t>(inflight_.size() - 1);
+        }
+        uint32_t slot = free_.back();
+        free_.pop_back();
+        return slot;
+    }
+
+    void complete(uint32_t slot, Cycle latency) {
+        const Inflight& inflight = inflight_[slot];
+        KpuCompletion completion;
+        completion.tag = inflight.tag;
+        completion.cycle = std::max(to_requester_.ceil(inflight.memory_issued + latency), inflight.issued);
+        completion.latency = completion.cycle - inflight.issued;
+        completion.is_write = inflight.is_write;
+        latest_due_ = std::max(latest_due_, completion.cycle);
+        due_.push({completion, seq_++});
+        free_.push_back(slot);
+        outstanding_--;
+    }
+
+    std::unique_ptr<Controller> controller_;
+    ClockRatio to_memory_;
+    ClockRatio to_requester_;
+    ClockStepper stepper_;
+    Cycle cycle_ = 0;
+
+    std::vector<Inflight> inflight_;             ///< Indexed by callback slot
+    std::vector<uint32_t> free_;                 ///< Free inflight_ slots
+    size_t outstanding_ = 0;                     ///< Submitted, not yet completed
+    std::priority_queue<Due, std::vector<Due>, std::greater<>> due_;
+    uint64_t seq_ = 0;
+    Cycle latest_due_ = 0;
+};
+
+} // namespace sw::memsim
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <sw/memsim/core/event_kernel.hpp>
+#include <sw/memsim/interface/memory_controller.hpp>
+
+namespace sw::memsim {
+
+/// Memory controller registered with an event kernel
+///
+/// The controller is ticked only while it has pending work; an idle
+/// controller sleeps and is fast-forwarded to the kernel's time (via
+/// set_cycle) when the next request arrives. Submit through this wrapper
+/// rather than the controller so the controller is woken.
+///
+/// Idle skipping is exact for controllers whose state does not evolve
+/// without requests (no refresh or power-down timers), which holds for the
+/// current models unless cycle-accurate refresh is enabled.
+class ControllerComponent final : public Component {
+public:
+    ControllerComponent(EventKernel& kernel, IMemoryController& controller)
+        : kernel_(kernel)
+        , controller_(controller)
+        , id_(kernel.add(*this))
+    {}
+
+    ~ControllerComponent() override { kernel_.remove(id_); }
+
+    ControllerComponent(const ControllerComponent&) = delete;
+    ControllerComponent& operator=(const ControllerComponent&) = delete;
+
+    /// Submit at the kernel's current cycle
+    std::optional<RequestId> submit(Request request) {
+        sync();
+        auto id = controller_.submit(std::move(request));
+        if (id && controller_.has_pending()) {
+            kernel_.wake(id_, controller_.cycle() + 1);
+        }
+        return id;
+    }
+
+    [[nodiscard]] bool can_accept() const { return controller_.can_accept(); }
+
+    std::optional<Cycle> wake(Cycle now) override {
+        if (now > 0) {
+            sync(now - 1);
+        }
+        controller_.tick();
+        ticks_++;
+        if (controller_.has_pending()) {
+            return controller_.cycle() + 1;
+        }
+        return std::nullopt;
+    }
+
+    [[nodiscard]] IMemoryController& controller() { return controller_; }
+    [[nodiscard]] const IMemoryController& controller() const { return controller_; }
+    [[nodiscard]] ComponentId id() const { return id_; }
+
+    /// Cycles the controller was actually ticked
+    [[nodiscard]] uint64_t ticks() const { return ticks_; }
+
+private:
+    /// Bring an idle controller forward to `cycle`
+    void sync(Cycle cycle) {
+        if (controller_.cycle() < cycle && !controller_.has_pending()) {
+            controller_.set_cycle(cycle);
+        }
+    }
+
+    void sync() { sync(kernel_.now()); }
+
+    EventKernel& kernel_;
+    IMemoryController& controller_;
+    ComponentId id_;
+    uint64_t ticks_ = 0;
+};
+
+} // namespace sw::memsim
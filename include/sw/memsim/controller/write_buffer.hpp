@@ -0,0 +1,135 @@
+#pragma once
+
+#include <sw/memsim/core/types.hpp>
+#include <sw/memsim/core/checkpoint.hpp>
+
+#include <list>
+#include <unordered_map>
+
+namespace sw::memsim {
+
+/// Controller-side posted write buffer
+///
+/// Writes are acknowledged when they enter the buffer and are written to
+/// DRAM later, oldest first. The buffer provides two traffic reductions:
+/// - Coalescing: a write to a burst-aligned address that is already
+///   buffered merges into the existing entry
+/// - Forwarding: a read to a buffered address is served from the buffer
+///   without a DRAM access (read-after-write)
+class WriteBuffer {
+public:
+    /// Result of posting a write
+    enum class PostResult : uint8_t {
+        INSERTED,   ///< New entry allocated
+        MERGED,     ///< Coalesced into an existing entry
+        FULL        ///< No space and nothing to merge with
+    };
+
+    /// @param capacity Number of entries (0 disables the buffer)
+    /// @param burst_bytes Coalescing granularity (power of two)
+    WriteBuffer(uint32_t capacity, uint32_t burst_bytes)
+        : capacity_(capacity)
+        , burst_mask_(~(static_cast<Address>(burst_bytes) - 1))
+    {}
+
+    // The index holds list iterators, so copies rebuild it
+    WriteBuffer(const WriteBuffer& other)
+        : capacity_(other.capacity_)
+        , burst_mask_(other.burst_mask_)
+        , entries_(other.entries_)
+    {
+        reindex();
+    }
+
+    WriteBuffer& operator=(const WriteBuffer& other) {
+        if (this != &other) {
+            capacity_ = other.capacity_;
+            burst_mask_ = other.burst_mask_;
+            entries_ = other.entries_;
+            reindex();
+        }
+        return *this;
+    }
+
+    WriteBuffer(WriteBuffer&&) = default;
+    WriteBuffer& operator=(WriteBuffer&&) = default;
+
+    [[nodiscard]] bool enabled() const { return capacity_ > 0; }
+
+    /// Burst-aligned address used as the coalescing key
+    [[nodiscard]] Address key(Address address) const {
+        return address & burst_mask_;
+    }
+
+    /// Post a write into the buffer
+    PostResult post(Request&& request) {
+        Address k = key(request.address);
+        if (index_.count(k)) {
+            return PostResult::MERGED;
+        }
+        if (full()) {
+            return PostResult::FULL;
+        }
+        entries_.push_back(std::move(request));
+        index_.emplace(k, std::prev(entries_.end()));
+        return PostResult::INSERTED;
+    }
+
+    /// Check whether a read to this address can be forwarded
+    [[nodiscard]] bool contains(Address address) const {
+        return index_.count(key(address)) != 0;
+    }
+
+    /// Remove and return the oldest buffered write
+    Request pop_oldest() {
+        Request request = std::move(entries_.front());
+        index_.erase(key(request.address));
+        entries_.pop_front();
+        return request;
+    }
+
+    void clear() {
+        entries_.clear();
+        index_.clear();
+    }
+
+    /// Serialize buffered writes, oldest first
+    void save(CheckpointWriter& out) const {
+        out.write<uint64_t>(entries_.size());
+        for (const Request& entry : entries_) {
+            out.write_request(entry);
+        }
+    }
+
+    /// Restore writes saved with save()
+    void restore(CheckpointReader& in) {
+        clear();
+        auto count = in.read<uint64_t>();
+        if (count > capacity_) {
+            throw CheckpointError("checkpoint write buffer exceeds capacity");
+        }
+        for (uint64_t i = 0; i < count; ++i) {
+            post(in.read_request());
+        }
+    }
+
+    [[nodiscard]] size_t size() const { return entries_.size(); }
+    [[nodiscard]] size_t capacity() const { return capacity_; }
+    [[nodiscard]] bool empty() const { return entries_.empty(); }
+    [[nodiscard]] bool full() const { return entries_.size() >= capacity_; }
+
+private:
+    void reindex() {
+        index_.clear();
+        for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+            index_.emplace(key(it->address), it);
+        }
+    }
+
+    uint32_t capacity_;
+    Address burst_mask_;
+    std::list<Request> entries_;
+    std::unordered_map<Address, std::list<Request>::iterator> index_;
+};
+
+} // namespace sw::memsim
@@ -0,0 +1,237 @@
+#pragma once
+
+#include <sw/memsim/core/types.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace sw::memsim {
+
+/// Error raised for malformed or mismatched checkpoints
+class CheckpointError : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+/// Magic bytes at the start of every checkpoint ("MSIMCKPT")
+inline constexpr uint64_t kCheckpointMagic = 0x54504B434D49534DULL;
+
+/// Checkpoint format version (bump on any layout change)
+inline constexpr uint32_t kCheckpointVersion = 6;
+
+// ============================================================================
+// Writer
+// ============================================================================
+
+/// Binary checkpoint writer
+///
+/// Values are appended in host byte order; checkpoints are meant to be
+/// restored by the same build on the same architecture (warm once, fork
+/// many runs), not exchanged between machines. Completion callbacks are
+/// not serializable and are never written.
+class CheckpointWriter {
+public:
+    /// Append a trivially copyable value
+    template <typename T>
+    void write(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "checkpoint values must be trivially copyable");
+        write_bytes(&value, sizeof(T));
+    }
+
+    void write_bytes(const void* data, size_t size) {
+        auto* bytes = static_cast<const uint8_t*>(data);
+        buffer_.insert(buffer_.end(), bytes, bytes + size);
+    }
+
+    void write_string(std::string_view text) {
+        write<uint64_t>(text.size());
+        write_bytes(text.data(), text.size());
+    }
+
+    /// Append a length-prefixed vector of trivially copyable values
+    template <typename T, typename Alloc>
+    void write_vector(const std::vector<T, Alloc>& values) {
+        write<uint64_t>(values.size());
+        for (const T& value : values) {
+            write(value);
+        }
+    }
+
+    /// Append a request (everything but its callback)
+    void write_request(const Request& request) {
+        write(request.id);
+        write(request.address);
+        write(request.size);
+        write(request.source);
+        write(request.type);
+        write(request.priority);
+        write(request.submit_cycle);
+        write(request.bank_index);
+        write(request.channel);
+        write(request.rank);
+        write(request.bank_group);
+        write(request.bank);
+        write(request.row);
+        write(request.column);
+        write(request.posted);
+    }
+
+    /// Append the checkpoint header identifying the controller kind
+    void write_header(Fidelity fidelity, Technology technology) {
+        write(kCheckpointMagic);
+        write(kCheckpointVersion);
+        write(fidelity);
+        write(technology);
+    }
+
+    [[nodiscard]] const std::vector<uint8_t>& data() const { return buffer_; }
+    [[nodiscard]] std::vector<uint8_t> take() { return std::move(buffer_); }
+
+    /// Write the buffer to a file
+    void save(const std::string& path) const {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(buffer_.data()),
+                   static_cast<std::streamsize>(buffer_.size()));
+        if (!file) {
+            throw CheckpointError("cannot write checkpoint: " + path);
+        }
+    }
+
+private:
+    std::vector<uint8_t> buffer_;
+};
+
+// ============================================================================
+// Reader
+// ============================================================================
+
+/// Binary checkpoint reader over a memory buffer
+///
+/// Every read is bounds-checked; a truncated or mismatched checkpoint
+/// raises CheckpointError instead of restoring a half-built state.
+class CheckpointReader {
+public:
+    explicit CheckpointReader(std::span<const uint8_t> data)
+        : data_(data)
+    {}
+
+    template <typename T>
+    T read() {
+        static_assert(std::is_trivially_copyable_v<T>, "checkpoint values must be trivially copyable");
+        T value;
+        read_bytes(&value, sizeof(T));
+        return value;
+    }
+
+    void read_bytes(void* out, size_t size) {
+        if (size > data_.size() - pos_) {
+            throw CheckpointError("checkpoint truncated");
+        }
+        std::memcpy(out, data_.data() + pos_, size);
+        pos_ += size;
+    }
+
+    std::string read_string() {
+        auto size = static_cast<size_t>(read<uint64_t>());
+        if (size > data_.size() - pos_) {
+            throw CheckpointError("checkpoint truncated");
+        }
+        std::string text(reinterpret_cast<const char*>(data_.data() + pos_), size);
+        pos_ += size;
+        return text;
+    }
+
+    template <typename T>
+    std::vector<T> read_vector() {
+        auto size = static_cast<size_t>(read<uint64_t>());
+        if (size > (data_.size() - pos_) / sizeof(T)) {
+            throw CheckpointError("checkpoint truncated");
+        }
+        std::vector<T> values(size);
+        for (T& value : values) {
+            value = read<T>();
+        }
+        return values;
+    }
+
+    /// Read a vector that must match an existing container's size
+    template <typename T, typename Alloc>
+    void read_vector_into(std::vector<T, Alloc>& values) {
+        if (read<uint64_t>() != values.size()) {
+            throw CheckpointError("checkpoint geometry does not match controller");
+        }
+        for (T& value : values) {
+            value = read<T>();
+        }
+    }
+
+    /// Read a request; the callback is left empty
+    Request read_request() {
+        Request request;
+        request.id = read<RequestId>();
+        request.address = read<Address>();
+        request.size = read<uint32_t>();
+        request.source = read<uint16_t>();
+        request.type = read<RequestType>();
+        request.priority = read<Priority>();
+        request.submit_cycle = read<Cycle>();
+        request.bank_index = read<BankIndex>();
+        request.channel = read<Channel>();
+        request.rank = read<Rank>();
+        request.bank_group = read<BankGroup>();
+        request.bank = read<Bank>();
+        request.row = read<Row>();
+        request.column = read<Column>();
+        request.posted = read<bool>();
+        return request;
+    }
+
+    /// Validate the header against the restoring controller
+    void read_header(Fidelity fidelity, Technology technology) {
+        if (read<uint64_t>() != kCheckpointMagic) {
+            throw CheckpointError("not a memsim checkpoint");
+        }
+        if (read<uint32_t>() != kCheckpointVersion) {
+            throw CheckpointError("unsupported checkpoint version");
+        }
+        if (read<Fidelity>() != fidelity || read<Technology>() != technology) {
+            throw CheckpointError("checkpoint was taken from a different controller type");
+        }
+    }
+
+    /// Check a saved value against the restoring controller's
+    template <typename T>
+    void expect(const T& value, const char* what) {
+        if (read<T>() != value) {
+            throw CheckpointError(std::string("checkpoint mismatch: ") + what);
+        }
+    }
+
+    [[nodiscard]] bool at_end() const { return pos_ == data_.size(); }
+
+    /// Read a whole checkpoint file into memory
+    static std::vector<uint8_t> load(const std::string& path) {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) {
+            throw CheckpointError("cannot read checkpoint: " + path);
+        }
+        std::vector<uint8_t> data(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        if (!file) {
+            throw CheckpointError("cannot read checkpoint: " + path);
+        }
+        return data;
+    }
+
+private:
+    std::span<const uint8_t> data_;
+    size_t pos_ = 0;
+};
+
+} // namespace sw::memsim
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <sw/memsim/core/types.hpp>
+
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+
+namespace sw::memsim {
+
+// ============================================================================
+// Clock Ratio
+// ============================================================================
+
+/// Exact rational conversion between the cycle counts of two clocks
+///
+/// `num` cycles of the target clock elapse during `den` cycles of the
+/// source clock. Conversions are exact (no accumulated rounding drift) and
+/// split the cycle count into whole periods of `den` so that they do not
+/// overflow for any realistic simulation length.
+struct ClockRatio {
+    uint64_t num = 1;
+    uint64_t den = 1;
+
+    /// Target edges at or before source cycle `cycles`
+    [[nodiscard]] constexpr Cycle floor(Cycle cycles) const {
+        return (cycles / den) * num + (cycles % den) * num / den;
+    }
+
+    /// First target cycle at or after source cycle `cycles`
+    [[nodiscard]] constexpr Cycle ceil(Cycle cycles) const {
+        return (cycles / den) * num + ((cycles % den) * num + den - 1) / den;
+    }
+
+    /// Conversion in the opposite direction
+    [[nodiscard]] constexpr ClockRatio inverse() const { return {den, num}; }
+
+    [[nodiscard]] constexpr bool identity() const { return num == den; }
+
+    constexpr bool operator==(const ClockRatio&) const = default;
+};
+
+/// Counts target-clock edges while stepping a source clock one cycle at a time
+///
+/// Integer phase accumulator: the per-cycle path adds and compares, it
+/// never divides.
+class ClockStepper {
+public:
+    explicit ClockStepper(const ClockRatio& ratio) : ratio_(ratio) {}
+
+    /// Target edges in the next source cycle
+    [[nodiscard]] uint64_t step() {
+        phase_ += ratio_.num;
+        uint64_t edges = 0;
+        while (phase_ >= ratio_.den) {
+            phase_ -= ratio_.den;
+            edges++;
+        }
+        return edges;
+    }
+
+    /// Re-align the phase to source cycle `cycle`
+    void seek(Cycle cycle) {
+        phase_ = (cycle % ratio_.den) * ratio_.num % ratio_.den;
+    }
+
+    [[nodiscard]] const ClockRatio& ratio() const { return ratio_; }
+
+private:
+    ClockRatio ratio_;
+    uint64_t phase_ = 0;        ///< Fraction of a target cycle elapsed, in 1/den units
+};
+
+// ============================================================================
+// Clock Domain
+// ============================================================================
+
+/// Clock defined by its period on a picosecond time base
+///
+/// The period is kept as a fraction of picoseconds so that clocks whose
+/// period is not a whole number of picoseconds (3200 MHz: 312.5 ps) still
+/// convert exactly.
+class ClockDomain {
+public:
+    /// Clock of `mhz` megahertz
+    [[nodiscard]] static ClockDomain from_mhz(uint64_t mhz) {
+        return ClockDomain(1'000'000, mhz);
+    }
+
+    /// Clock with a period of `period_ps` picoseconds
+    [[nodiscard]] static ClockDomain from_period_ps(uint64_t period_ps) {
+        return ClockDomain(period_ps, 1);
+    }
+
+    /// Period as the fraction period_num() / period_den() picoseconds
+    [[nodiscard]] uint64_t period_num() const { return num_; }
+    [[nodiscard]] uint64_t period_den() const { return den_; }
+
+    [[nodiscard]] double period_ps() const { return static_cast<double>(num_) / den_; }
+    [[nodiscard]] double frequency_mhz() const { return 1e6 * den_ / num_; }
+
+    /// Time of the start of cycle `cycles` (rounded down to a picosecond)
+    [[nodiscard]] uint64_t to_ps(Cycle cycles) const { return ClockRatio{num_, den_}.floor(cycles); }
+
+    /// Cycles completed by time `ps`
+    [[nodiscard]] Cycle from_ps(uint64_t ps) const { return ClockRatio{den_, num_}.floor(ps); }
+
+    /// Ratio converting cycles of this clock into cycles of `target`
+    [[nodiscard]] ClockRatio ratio_to(const ClockDomain& target) const {
+        // cycles_target = cycles * period_this / period_target
+        uint64_t num = num_ * target.den_;
+        uint64_t den = den_ * target.num_;
+        uint64_t g = std::gcd(num, den);
+        return {num / g, den / g};
+    }
+
+    bool operator==(const ClockDomain&) const = default;
+
+private:
+    ClockDomain(uint64_t num, uint64_t den) {
+        if (num == 0 || den == 0) {
+            throw std::invalid_argument("clock period and frequency must be non-zero");
+        }
+        uint64_t g = std::gcd(num, den);
+        num_ = num / g;
+        den_ = den / g;
+    }
+
+    uint64_t num_;
+    uint64_t den_;
+};
+
+} // namespace sw::memsim
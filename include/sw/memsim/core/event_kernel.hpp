@@ -0,0 +1,272 @@
+#pragma once
+
+#include <sw/memsim/core/types.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace sw::memsim {
+
+/// Component woken by the event kernel
+class Component {
+public:
+    virtual ~Component() = default;
+
+    /// Handle a wake-up at `now`; return the next cycle to be woken, if any
+    virtual std::optional<Cycle> wake(Cycle now) = 0;
+};
+
+using ComponentId = uint32_t;
+
+// ============================================================================
+// Event Kernel
+// ============================================================================
+
+/// Discrete-event simulation kernel shared by controllers and agents
+///
+/// Time advances straight from one cycle with events to the next, so idle
+/// components cost nothing. Events due within `wheel_slots` cycles live in
+/// a timing wheel (one slot per cycle, with an occupancy bitmap for finding
+/// the next busy slot); later events wait in a priority queue and move
+/// into the wheel as time approaches them. Events of the same cycle run in
+/// the order they were scheduled, including events scheduled for the
+/// current cycle while it is being processed.
+///
+/// Two kinds of events are supported:
+/// - Actions: one-shot callbacks (schedule_at / schedule_in)
+/// - Component wake-ups: each registered component has at most one pending
+///   wake-up; requesting an earlier one supersedes the later
+class EventKernel {
+public:
+    using Action = std::function<void()>;
+
+    static constexpr Cycle kNever = std::numeric_limits<Cycle>::max();
+
+    explicit EventKernel(size_t wheel_slots = 1024, Cycle start = 0)
+        : now_(start)
+        , slots_(std::bit_ceil(std::max<size_t>(wheel_slots, 64)))
+        , mask_(slots_.size() - 1)
+        , occupied_(slots_.size() / 64, 0)
+    {}
+
+    EventKernel(const EventKernel&) = delete;
+    EventKernel& operator=(const EventKernel&) = delete;
+
+    // ========================================================================
+    // Scheduling
+    // ========================================================================
+
+    /// Run an action at cycle `when` (not earlier than now())
+    void schedule_at(Cycle when, Action action) {
+        insert({when, 0, kNoComponent, std::move(action)});
+    }
+
+    /// Run an action `delay` cycles from now
+    void schedule_in(Cycle delay, Action action) {
+        schedule_at(now_ + delay, std::move(action));
+    }
+
+    /// Register a component; it sleeps until woken
+    ComponentId add(Component& component) {
+        components_.push_back(&component);
+        next_wake_.push_back(kNever);
+        return static_cast<ComponentId>(components_.size() - 1);
+    }
+
+    /// Unregister a component; pending wake-ups are dropped
+    void remove(ComponentId id) {
+        components_.at(id) = nullptr;
+        next_wake_[id] = kNever;
+    }
+
+    /// Wake a component at `when` unless it is already due earlier
+    void wake(ComponentId id, Cycle when) {
+        if (when < next_wake_.at(id)) {
+            next_wake_[id] = when;
+            insert({when, 0, id, nullptr});
+        }
+    }
+
+    /// Cycle of a component's pending wake-up (kNever when asleep)
+    [[nodiscard]] Cycle next_wake(ComponentId id) const { return next_wake_.at(id); }
+
+    // ========================================================================
+    // Execution
+    // ========================================================================
+
+    [[nodiscard]] Cycle now() const { return now_; }
+    [[nodiscard]] bool idle() const { return pending_ == 0; }
+    [[nodiscard]] size_t pending_events() const { return pending_; }
+
+    /// Cycle of the earliest pending event, if any
+    [[nodiscard]] std::optional<Cycle> next_event() const {
+        std::optional<Cycle> next;
+        if (wheel_count_ > 0) {
+            next = now_ + distance_to_next_slot();
+        }
+        if (!far_.empty() && (!next || far_.top().when < *next)) {
+            next = far_.top().when;
+        }
+        return next;
+    }
+
+    /// Advance to the next cycle with events and process all of them;
+    /// returns false when no events are pending
+    bool step() {
+        auto next = next_event();
+        if (!next) {
+            return false;
+        }
+        advance_to(*next);
+        process_current();
+        return true;
+    }
+
+    /// Run until no events remain
+    void run() {
+        while (step()) {
+        }
+    }
+
+    /// Process every event up to and including `end`, then stop at `end`
+    void run_until(Cycle end) {
+        for (auto next = next_event(); next && *next <= end; next = next_event()) {
+            advance_to(*next);
+            process_current();
+        }
+        if (end > now_) {
+            advance_to(end);
+        }
+    }
+
+    // ========================================================================
+    // Statistics
+    // ========================================================================
+
+    /// Events executed (stale component wake-ups excluded)
+    [[nodiscard]] uint64_t events_processed() const { return events_processed_; }
+
+    /// Distinct cycles at which events ran
+    [[nodiscard]] uint64_t active_cycles() const { return active_cycles_; }
+
+private:
+    static constexpr ComponentId kNoComponent = std::numeric_limits<ComponentId>::max();
+
+    struct Event {
+        Cycle when;
+        uint64_t seq;                 ///< Scheduling order (far queue ties)
+        ComponentId component;
+        Action action;
+    };
+
+    struct LaterFirst {
+        bool operator()(const Event& a, const Event& b) const {
+            return a.when != b.when ? a.when > b.when : a.seq > b.seq;
+        }
+    };
+
+    void insert(Event event) {
+        if (event.when < now_) {
+            throw std::invalid_argument("cannot schedule an event in the past");
+        }
+        event.seq = seq_++;
+        pending_++;
+        if (event.when - now_ < slots_.size()) {
+            put_in_wheel(std::move(event));
+        } else {
+            far_.push(std::move(event));
+        }
+    }
+
+    void put_in_wheel(Event event) {
+        size_t slot = event.when & mask_;
+        slots_[slot].push_back(std::move(event));
+        occupied_[slot / 64] |= uint64_t{1} << (slot % 64);
+        wheel_count_++;
+    }
+
+    /// Cycles from now to the first occupied wheel slot (wheel not empty)
+    [[nodiscard]] Cycle distance_to_next_slot() const {
+        const size_t start = now_ & mask_;
+        const size_t words = occupied_.size();
+        size_t word = start / 64;
+        uint64_t bits = occupied_[word] & (~uint64_t{0} << (start % 64));
+        for (size_t i = 0; i <= words; ++i) {
+            if (bits) {
+                size_t slot = word * 64 + static_cast<size_t>(std::countr_zero(bits));
+                return (slot - start) & mask_;
+            }
+            word = (word + 1) % words;
+            bits = occupied_[word];
+        }
+        return 0;
+    }
+
+    /// Move time forward, pulling far events that now fit in the wheel
+    void advance_to(Cycle when) {
+        now_ = when;
+        while (!far_.empty() && far_.top().when - now_ < slots_.size()) {
+            put_in_wheel(std::move(const_cast<Event&>(far_.top())));
+            far_.pop();
+        }
+    }
+
+    void process_current() {
+        const size_t slot = now_ & mask_;
+        bool ran = false;
+        while (!slots_[slot].empty()) {
+            batch_.swap(slots_[slot]);
+            occupied_[slot / 64] &= ~(uint64_t{1} << (slot % 64));
+            wheel_count_ -= batch_.size();
+            pending_ -= batch_.size();
+            for (Event& event : batch_) {
+                ran |= dispatch(event);
+            }
+            batch_.clear();
+        }
+        active_cycles_ += ran;
+    }
+
+    bool dispatch(Event& event) {
+        if (event.component == kNoComponent) {
+            events_processed_++;
+            event.action();
+            return true;
+        }
+        ComponentId id = event.component;
+        if (next_wake_[id] != event.when || components_[id] == nullptr) {
+            return false;   // superseded by an earlier wake-up
+        }
+        next_wake_[id] = kNever;
+        events_processed_++;
+        if (auto next = components_[id]->wake(now_)) {
+            wake(id, *next);
+        }
+        return true;
+    }
+
+    Cycle now_ = 0;
+    std::vector<std::vector<Event>> slots_;
+    size_t mask_;
+    std::vector<uint64_t> occupied_;
+    size_t wheel_count_ = 0;
+    std::priority_queue<Event, std::vector<Event>, LaterFirst> far_;
+    std::vector<Event> batch_;          ///< Slot being processed
+    size_t pending_ = 0;
+    uint64_t seq_ = 0;
+
+    std::vector<Component*> components_;
+    std::vector<Cycle> next_wake_;
+
+    uint64_t events_processed_ = 0;
+    uint64_t active_cycles_ = 0;
+};
+
+} // namespace sw::memsim
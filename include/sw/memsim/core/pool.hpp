@@ -0,0 +1,140 @@
+#pragma once
+
+#include <sw/memsim/core/checkpoint.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace sw::memsim {
+
+/// Fixed-capacity object pool with stable addresses
+///
+/// Controllers hand raw pointers to schedulers, so in-flight records must
+/// not move while they are buffered. The pool allocates all slots up front
+/// and recycles them through a free list, which keeps the hot path free of
+/// heap allocation.
+template <typename T>
+class Pool {
+public:
+    explicit Pool(size_t capacity = 0)
+        : slots_(capacity)
+    {
+        free_.reserve(capacity);
+        for (size_t i = capacity; i > 0; --i) {
+            free_.push_back(static_cast<uint32_t>(i - 1));
+        }
+    }
+
+    /// Move an object into a free slot
+    ///
+    /// @return Pointer to the pooled object, or nullptr if the pool is exhausted
+    T* acquire(T&& value) {
+        if (free_.empty()) {
+            return nullptr;
+        }
+        uint32_t idx = free_.back();
+        free_.pop_back();
+        slots_[idx] = std::move(value);
+        return &slots_[idx];
+    }
+
+    /// Return an object to the pool
+    void release(T* object) {
+        *object = T{};
+        free_.push_back(static_cast<uint32_t>(object - slots_.data()));
+    }
+
+    /// Release every slot
+    void clear() {
+        free_.clear();
+        for (size_t i = slots_.size(); i > 0; --i) {
+            slots_[i - 1] = T{};
+            free_.push_back(static_cast<uint32_t>(i - 1));
+        }
+    }
+
+    [[nodiscard]] bool empty() const { return free_.size() == slots_.size(); }
+    [[nodiscard]] bool full() const { return free_.empty(); }
+    [[nodiscard]] size_t capacity() const { return slots_.size(); }
+    [[nodiscard]] size_t in_use() const { return slots_.size() - free_.size(); }
+
+    /// Slot index of a pooled object (stable across copies of the pool)
+    [[nodiscard]] size_t index_of(const T* object) const {
+        return static_cast<size_t>(object - slots_.data());
+    }
+
+    /// Object at a slot index
+    [[nodiscard]] T* at(size_t index) { return &slots_[index]; }
+    [[nodiscard]] const T* at(size_t index) const { return &slots_[index]; }
+
+    /// Object at a slot index read from a checkpoint
+    ///
+    /// @throws CheckpointError if the slot is out of range or free
+    [[nodiscard]] T* checked_at(size_t index) {
+        if (index >= slots_.size() ||
+            std::find(free_.begin(), free_.end(), index) != free_.end()) {
+            throw CheckpointError("checkpoint refers to a free or missing pool slot");
+        }
+        return &slots_[index];
+    }
+
+    /// Serialize the free list and every live slot
+    ///
+    /// The free list is saved in order so a restored pool hands out the same
+    /// slot indices as the original would.
+    template <typename WriteItem>
+    void save(CheckpointWriter& out, WriteItem write_item) const {
+        out.write<uint64_t>(slots_.size());
+        out.write_vector(free_);
+
+        std::vector<uint8_t> is_free(slots_.size(), 0);
+        for (uint32_t idx : free_) {
+            is_free[idx] = 1;
+        }
+        for (uint32_t idx = 0; idx < slots_.size(); ++idx) {
+            if (!is_free[idx]) {
+                out.write(idx);
+                write_item(out, slots_[idx]);
+            }
+        }
+    }
+
+    /// Restore a pool saved with save() (capacities must match)
+    template <typename ReadItem>
+    void restore(CheckpointReader& in, ReadItem read_item) {
+        in.expect<uint64_t>(slots_.size(), "pool capacity");
+        std::vector<uint32_t> free = in.read_vector<uint32_t>();
+        if (free.size() > slots_.size()) {
+            throw CheckpointError("checkpoint pool free list is corrupt");
+        }
+
+        // Every slot must be free or live exactly once
+        std::vector<uint8_t> seen(slots_.size(), 0);
+        for (uint32_t idx : free) {
+            if (idx >= slots_.size() || seen[idx]) {
+                throw CheckpointError("checkpoint pool free list is corrupt");
+            }
+            seen[idx] = 1;
+        }
+
+        clear();
+        free_ = std::move(free);
+        for (size_t n = in_use(); n > 0; --n) {
+            auto idx = in.read<uint32_t>();
+            if (idx >= slots_.size() || seen[idx]) {
+                throw CheckpointError("checkpoint pool slot out of range or duplicated");
+            }
+            seen[idx] = 1;
+            slots_[idx] = read_item(in);
+        }
+    }
+
+private:
+    std::vector<T> slots_;
+    std::vector<uint32_t> free_;
+};
+
+} // namespace sw::memsim
@@ -16,10 +16,20 @@ struct Statistics {
     uint64_t page_empty = 0;      ///< Access to closed bank
     uint64_t page_conflicts = 0;  ///< Different row was open
 
+    // Command counts
+    uint64_t activates = 0;
+    uint64_t precharges = 0;       ///< Explicit PRE commands
+    uint64_t auto_precharges = 0;  ///< RDA/WRA commands
+
+    // Write buffer statistics
+    uint64_t write_merges = 0;     ///< Writes coalesced into a buffered write
+    uint64_t read_forwards = 0;    ///< Reads served from the write buffer
+    uint64_t read_merges = 0;      ///< Reads merged into an outstanding read
+
     // Latency statistics (in cycles)
     uint64_t total_read_latency = 0;
     uint64_t total_write_latency = 0;
-    uint64_t min_latency = std::numeric_limits<uint64_t>::max();
+    uint64_t min_latency = std::numeric_limits<uint64_t>::max();  ///< Excludes posted requests
     uint64_t max_latency = 0;
 
     // Utilization (in cycles)
@@ -34,6 +44,7 @@ struct Statistics {
     // Turnaround statistics
     uint64_t read_to_write_turnarounds = 0;
     uint64_t write_to_read_turnarounds = 0;
+    uint64_t rank_switches = 0;    ///< Column accesses to another rank than the last
 
     // Power statistics
     uint64_t active_cycles = 0;
@@ -85,12 +96,15 @@ struct Statistics {
     void reset() {
         reads = writes = 0;
         page_hits = page_empty = page_conflicts = 0;
+        activates = precharges = auto_precharges = 0;
+        write_merges = read_forwards = read_merges = 0;
         total_read_latency = total_write_latency = 0;
         min_latency = std::numeric_limits<uint64_t>::max();
         max_latency = 0;
         busy_cycles = idle_cycles = stall_cycles = 0;
         refreshes = refresh_cycles = 0;
         read_to_write_turnarounds = write_to_read_turnarounds = 0;
+        rank_switches = 0;
         active_cycles = precharge_cycles = powerdown_cycles = 0;
     }
 
@@ -101,6 +115,12 @@ struct Statistics {
         page_hits += other.page_hits;
         page_empty += other.page_empty;
         page_conflicts += other.page_conflicts;
+        activates += other.activates;
+        precharges += other.precharges;
+        auto_precharges += other.auto_precharges;
+        write_merges += other.write_merges;
+        read_forwards += other.read_forwards;
+        read_merges += other.read_merges;
         total_read_latency += other.total_read_latency;
         total_write_latency += other.total_write_latency;
         min_latency = std::min(min_latency, other.min_latency);
@@ -112,6 +132,7 @@ struct Statistics {
         refresh_cycles += other.refresh_cycles;
         read_to_write_turnarounds += other.read_to_write_turnarounds;
         write_to_read_turnarounds += other.write_to_read_turnarounds;
+        rank_switches += other.rank_switches;
         active_cycles += other.active_cycles;
         precharge_cycles += other.precharge_cycles;
         powerdown_cycles += other.powerdown_cycles;
@@ -119,6 +140,12 @@ struct Statistics {
 
     /// Record a completed request
     void record_request(RequestType type, Cycle latency, bool page_hit, bool page_conflict) {
+        record_completion(type, latency);
+        record_page_access(page_hit, page_conflict);
+    }
+
+    /// Record request completion without a row buffer access
+    void record_completion(RequestType type, Cycle latency) {
         if (type == RequestType::READ) {
             reads++;
             total_read_latency += latency;
@@ -127,6 +154,25 @@ struct Statistics {
             total_write_latency += latency;
         }
 
+        min_latency = std::min(min_latency, latency);
+        max_latency = std::max(max_latency, latency);
+    }
+
+    /// Record a request acknowledged without a DRAM access (posted write,
+    /// forwarded read)
+    ///
+    /// It counts toward the request totals and averages with zero latency
+    /// but not toward min/max_latency, which describe serviced requests.
+    void record_posted(RequestType type) {
+        if (type == RequestType::READ) {
+            reads++;
+        } else {
+            writes++;
+        }
+    }
+
+    /// Record the row buffer outcome of a DRAM column access
+    void record_page_access(bool page_hit, bool page_conflict) {
         if (page_hit) {
             page_hits++;
         } else if (page_conflict) {
@@ -134,9 +180,6 @@ struct Statistics {
         } else {
             page_empty++;
         }
-
-        min_latency = std::min(min_latency, latency);
-        max_latency = std::max(max_latency, latency);
     }
 };
 
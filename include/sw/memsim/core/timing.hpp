@@ -1,5 +1,7 @@
 #pragma once
 
+#include <sw/memsim/core/clock.hpp>
+
 #include <cstdint>
 
 namespace sw::memsim {
@@ -28,6 +30,7 @@ struct TimingParams {
     uint32_t tWTR_L = 10;    ///< Write to read (same bank group)
     uint32_t tWTR_S = 4;     ///< Write to read (different bank group)
     uint32_t tRTW = 14;      ///< Read to write (bus turnaround)
+    uint32_t tRTRS = 2;      ///< Rank to rank switch on the data bus
 
     // === Burst Timing ===
     uint32_t tBurst = 8;     ///< Burst length in cycles (BL16 / 2)
@@ -62,7 +65,7 @@ struct TimingParams {
 
 /// Organization parameters
 struct OrganizationParams {
-    uint8_t num_channels = 1;
+    uint16_t num_channels = 1;
     uint8_t ranks_per_channel = 1;
     uint8_t bank_groups_per_rank = 4;
     uint8_t banks_per_bank_group = 4;
@@ -75,12 +78,26 @@ struct OrganizationParams {
     uint32_t burst_length = 16;          ///< BL16
 
     // Derived values
-    uint8_t banks_per_rank() const {
-        return bank_groups_per_rank * banks_per_bank_group;
+    uint32_t banks_per_rank() const {
+        return static_cast<uint32_t>(bank_groups_per_rank) * banks_per_bank_group;
+    }
+
+    uint32_t banks_per_channel() const {
+        return ranks_per_channel * banks_per_rank();
+    }
+
+    /// Bytes transferred by one column access (burst)
+    uint32_t burst_bytes() const {
+        return burst_length * (device_width / 8) * devices_per_rank;
+    }
+
+    uint32_t total_banks() const {
+        return num_channels * banks_per_channel();
     }
 
-    uint8_t total_banks() const {
-        return num_channels * ranks_per_channel * banks_per_rank();
+    /// Flat index of a bank, channel-major
+    BankIndex flat_bank(Channel channel, Rank rank, Bank bank) const {
+        return channel * banks_per_channel() + rank * banks_per_rank() + bank;
     }
 
     uint64_t channel_capacity_bytes() const {
@@ -97,6 +114,13 @@ struct OrganizationParams {
     }
 };
 
+/// Controller write buffer parameters
+struct WriteBufferParams {
+    uint32_t entries = 0;                ///< Buffered writes (0 = disabled)
+    uint32_t high_watermark = 24;        ///< Start forced drain at this occupancy
+    uint32_t low_watermark = 8;          ///< Stop forced drain at this occupancy
+};
+
 /// Complete memory controller configuration
 struct ControllerConfig {
     Technology technology = Technology::IDEAL;
@@ -111,6 +135,19 @@ struct ControllerConfig {
     // Address mapping
     AddressMapping address_mapping = AddressMapping::ROW_BANK_COLUMN;
 
+    // Row buffer management and scheduling (CYCLE_ACCURATE)
+    PagePolicy page_policy = PagePolicy::OPEN;
+    SchedulerPolicy scheduler = SchedulerPolicy::FR_FCFS;  ///< FIFO, FR_FCFS or FR_FCFS_GRP
+    uint32_t max_row_hit_streak = 0;     ///< Row hits per bank before FCFS is forced (0 = unlimited)
+    uint64_t max_request_age = 0;        ///< Cycles before the oldest request is forced (0 = disabled)
+    uint32_t max_rank_batch = 16;        ///< Column accesses to one rank before other ranks' row hits go first (0 = no limit)
+
+    // Refresh (CYCLE_ACCURATE)
+    bool enable_refresh = false;         ///< All-bank refresh of each rank every tREFI
+
+    // Posted write buffer (CYCLE_ACCURATE)
+    WriteBufferParams write_buffer;
+
     // Observability
     bool enable_tracing = false;
     bool enable_statistics = true;
@@ -125,6 +162,11 @@ struct ControllerConfig {
     uint32_t clock_period_ps() const {
         return 1'000'000 / clock_mhz();
     }
+
+    /// Memory clock domain (exact period, unlike clock_period_ps())
+    ClockDomain clock() const {
+        return ClockDomain::from_mhz(clock_mhz());
+    }
 };
 
 // ============================================================================
@@ -13,8 +13,8 @@ namespace sw::memsim {
 
 /// Simulation fidelity levels
 enum class Fidelity : uint8_t {
-    BEHAVIORAL,      ///< Instant/fixed latency (~100-1000x faster)
-    TRANSACTIONAL,   ///< Queue-based statistical timing (~10-100x faster)
+    BEHAVIORAL,      ///< Instant/fixed latency (~85x faster)
+    TRANSACTIONAL,   ///< Queue-based statistical timing (~11x faster)
     CYCLE_ACCURATE   ///< Full protocol state machines (1x baseline)
 };
 
@@ -115,6 +115,34 @@ constexpr std::string_view to_string(BankState s) {
     }
 }
 
+// ============================================================================
+// DRAM Commands
+// ============================================================================
+
+/// DRAM command issued by a cycle-accurate controller
+enum class Command : uint8_t {
+    ACT,    ///< Activate (open row)
+    PRE,    ///< Precharge (close row)
+    RD,     ///< Read
+    RDA,    ///< Read with auto-precharge
+    WR,     ///< Write
+    WRA,    ///< Write with auto-precharge
+    REF     ///< Refresh
+};
+
+constexpr std::string_view to_string(Command c) {
+    switch (c) {
+        case Command::ACT: return "ACT";
+        case Command::PRE: return "PRE";
+        case Command::RD:  return "RD";
+        case Command::RDA: return "RDA";
+        case Command::WR:  return "WR";
+        case Command::WRA: return "WRA";
+        case Command::REF: return "REF";
+        default: return "UNKNOWN";
+    }
+}
+
 // ============================================================================
 // Type Aliases
 // ============================================================================
@@ -123,12 +151,15 @@ using Cycle = uint64_t;
 using Address = uint64_t;
 using Row = uint32_t;
 using Column = uint16_t;
-using Bank = uint8_t;
+using Bank = uint8_t;             ///< Bank within a rank
 using BankGroup = uint8_t;
-using Channel = uint8_t;
+using Channel = uint16_t;
 using Rank = uint8_t;
 using RequestId = uint64_t;
 
+/// Flat bank index across all channels and ranks of a controller
+using BankIndex = uint32_t;
+
 /// Callback invoked when a request completes
 /// Parameter is the latency in cycles
 using CompletionCallback = std::function<void(Cycle latency)>;
@@ -142,18 +173,22 @@ struct Request {
     RequestId id = 0;           ///< Unique request identifier
     Address address = 0;        ///< Physical memory address
     uint32_t size = 0;          ///< Transfer size in bytes
+    uint16_t source = 0;        ///< Requesting master (core, DMA engine, ...)
     RequestType type = RequestType::READ;
     Priority priority = Priority::NORMAL;
     Cycle submit_cycle = 0;     ///< Cycle when request was submitted
     CompletionCallback callback = nullptr;
 
-    // Decoded address components (filled by controller)
+    // Decoded address components (filled by controller), ordered to
+    // pack into 16 bytes
+    BankIndex bank_index = 0;   ///< Flat bank across channels and ranks
+    Row row = 0;
     Channel channel = 0;
+    Column column = 0;
     Rank rank = 0;
     BankGroup bank_group = 0;
     Bank bank = 0;
-    Row row = 0;
-    Column column = 0;
+    bool posted = false;        ///< Already acknowledged (drained buffered write)
 };
 
 // ============================================================================
@@ -168,4 +203,52 @@ enum class AddressMapping : uint8_t {
     CUSTOM               ///< User-defined bit mapping
 };
 
+// ============================================================================
+// Page Policy
+// ============================================================================
+
+/// Row buffer management policy
+enum class PagePolicy : uint8_t {
+    OPEN,             ///< Keep row open until a conflicting request arrives
+    CLOSED,           ///< Auto-precharge after every column access
+    OPEN_ADAPTIVE,    ///< Auto-precharge when no row hit but a conflict is pending
+    CLOSED_ADAPTIVE   ///< Auto-precharge unless another row hit is pending
+};
+
+constexpr std::string_view to_string(PagePolicy p) {
+    switch (p) {
+        case PagePolicy::OPEN:            return "OPEN";
+        case PagePolicy::CLOSED:          return "CLOSED";
+        case PagePolicy::OPEN_ADAPTIVE:   return "OPEN_ADAPTIVE";
+        case PagePolicy::CLOSED_ADAPTIVE: return "CLOSED_ADAPTIVE";
+        default: return "UNKNOWN";
+    }
+}
+
+// ============================================================================
+// Scheduler Policy
+// ============================================================================
+
+/// Scheduler policy types
+enum class SchedulerPolicy : uint8_t {
+    FIFO,           ///< Simple FIFO per bank
+    FR_FCFS,        ///< First-Ready FCFS (row hit priority)
+    FR_FCFS_GRP,    ///< FR-FCFS with R/W grouping
+    GRP_FR_FCFS,    ///< Grouping priority over row hits
+    GRP_FR_FCFS_WM, ///< Grouping with watermark thresholds
+    QOS_AWARE       ///< QoS-aware for mixed criticality
+};
+
+constexpr std::string_view to_string(SchedulerPolicy p) {
+    switch (p) {
+        case SchedulerPolicy::FIFO:          return "FIFO";
+        case SchedulerPolicy::FR_FCFS:       return "FR_FCFS";
+        case SchedulerPolicy::FR_FCFS_GRP:   return "FR_FCFS_GRP";
+        case SchedulerPolicy::GRP_FR_FCFS:   return "GRP_FR_FCFS";
+        case SchedulerPolicy::GRP_FR_FCFS_WM: return "GRP_FR_FCFS_WM";
+        case SchedulerPolicy::QOS_AWARE:     return "QOS_AWARE";
+        default: return "UNKNOWN";
+    }
+}
+
 } // namespace sw::memsim
@@ -0,0 +1,316 @@
+#pragma once
+
+#include <sw/memsim/interface/memory_controller.hpp>
+#include <sw/memsim/core/pool.hpp>
+#include <sw/memsim/frontend/controller_decorator.hpp>
+#include <sw/memsim/frontend/mshr.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <deque>
+#include <queue>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace sw::memsim {
+
+// ============================================================================
+// Cache Policies
+// ============================================================================
+
+/// Write hit policy
+enum class WritePolicy : uint8_t {
+    WRITE_BACK,     ///< Mark line dirty, write to memory on eviction
+    WRITE_THROUGH   ///< Forward every write to memory
+};
+
+constexpr std::string_view to_string(WritePolicy p) {
+    switch (p) {
+        case WritePolicy::WRITE_BACK:    return "WRITE_BACK";
+        case WritePolicy::WRITE_THROUGH: return "WRITE_THROUGH";
+        default: return "UNKNOWN";
+    }
+}
+
+/// Write miss policy
+enum class AllocatePolicy : uint8_t {
+    WRITE_ALLOCATE,     ///< Fetch the line, then write into the cache
+    NO_WRITE_ALLOCATE   ///< Forward the write to memory, do not allocate
+};
+
+constexpr std::string_view to_string(AllocatePolicy p) {
+    switch (p) {
+        case AllocatePolicy::WRITE_ALLOCATE:    return "WRITE_ALLOCATE";
+        case AllocatePolicy::NO_WRITE_ALLOCATE: return "NO_WRITE_ALLOCATE";
+        default: return "UNKNOWN";
+    }
+}
+
+/// Cache configuration
+struct CacheConfig {
+    uint64_t size_bytes = 2 * 1024 * 1024;   ///< Capacity
+    uint32_t ways = 16;                      ///< Associativity (<= 64)
+    uint32_t line_bytes = 64;                ///< Line size (power of two)
+
+    WritePolicy write_policy = WritePolicy::WRITE_BACK;
+    AllocatePolicy allocate_policy = AllocatePolicy::WRITE_ALLOCATE;
+
+    uint32_t hit_latency = 4;                ///< Lookup-to-data latency (cycles)
+    uint32_t mshrs = 16;                     ///< Outstanding line fills
+    uint32_t mshr_targets = 8;               ///< Requests merged per fill
+    uint32_t queue_depth = 64;               ///< Requests in flight through the cache
+
+    /// Number of sets (power of two)
+    uint32_t num_sets() const {
+        return static_cast<uint32_t>(size_bytes / (static_cast<uint64_t>(line_bytes) * ways));
+    }
+};
+
+/// Cache statistics
+struct CacheStatistics {
+    uint64_t read_hits = 0;
+    uint64_t read_misses = 0;
+    uint64_t write_hits = 0;
+    uint64_t write_misses = 0;
+
+    uint64_t mshr_merges = 0;     ///< Misses merged into an outstanding fill
+    uint64_t mshr_stalls = 0;     ///< Lookups stalled for lack of MSHRs/targets
+    uint64_t fills = 0;           ///< Lines fetched from memory
+    uint64_t evictions = 0;       ///< Valid lines replaced
+    uint64_t writebacks = 0;      ///< Dirty lines written to memory
+    uint64_t write_throughs = 0;  ///< Writes forwarded to memory
+
+    uint64_t hits() const { return read_hits + write_hits; }
+    uint64_t misses() const { return read_misses + write_misses; }
+
+    double hit_rate() const {
+        uint64_t total = hits() + misses();
+        return total > 0 ? static_cast<double>(hits()) / total : 0.0;
+    }
+
+    /// Lines of memory traffic generated per access
+    double memory_traffic_ratio() const {
+        uint64_t total = hits() + misses();
+        return total > 0
+            ? static_cast<double>(fills + writebacks + write_throughs) / total
+            : 0.0;
+    }
+
+    void reset() {
+        *this = CacheStatistics{};
+    }
+};
+
+// ============================================================================
+// Tag Array
+// ============================================================================
+
+/// Set-associative tag array in structure-of-arrays layout
+///
+/// Tags, LRU stamps and dirty bits live in separate contiguous arrays so a
+/// lookup touches only the tags of one set, which are compared against the
+/// requested line with SIMD (AVX2 when available, otherwise a branch-free
+/// loop the compiler can vectorize). Tags hold the full line address, so
+/// invalid ways are marked with a sentinel instead of a valid bit.
+class TagArray {
+public:
+    static constexpr Address kInvalid = ~Address{0};
+
+    TagArray(uint32_t sets, uint32_t ways)
+        : sets_(sets)
+        , ways_(ways)
+        , tags_(static_cast<size_t>(sets) * ways, kInvalid)
+        , stamps_(static_cast<size_t>(sets) * ways, 0)
+        , dirty_(static_cast<size_t>(sets) * ways, 0)
+    {}
+
+    [[nodiscard]] uint32_t set_of(Address line) const {
+        return static_cast<uint32_t>(line & (sets_ - 1));
+    }
+
+    /// Find the way holding a line (-1 on miss)
+    [[nodiscard]] int find(uint32_t set, Address line) const {
+        const Address* tags = &tags_[static_cast<size_t>(set) * ways_];
+        uint32_t w = 0;
+#if defined(__AVX2__)
+        const __m256i needle = _mm256_set1_epi64x(static_cast<long long>(line));
+        for (; w + 4 <= ways_; w += 4) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tags + w));
+            int mask = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(v, needle)));
+            if (mask != 0) {
+                return static_cast<int>(w + std::countr_zero(static_cast<unsigned>(mask)));
+            }
+        }
+#endif
+        uint64_t match = 0;
+        for (uint32_t i = w; i < ways_; ++i) {
+            match |= static_cast<uint64_t>(tags[i] == line) << i;
+        }
+        return match != 0 ? std::countr_zero(match) : -1;
+    }
+
+    /// Select a replacement victim: an invalid way, else least recently used
+    [[nodiscard]] uint32_t victim(uint32_t set) const {
+        size_t base = static_cast<size_t>(set) * ways_;
+        uint32_t best = 0;
+        uint64_t best_stamp = ~uint64_t{0};
+        for (uint32_t w = 0; w < ways_; ++w) {
+            uint64_t stamp = (tags_[base + w] == kInvalid) ? 0 : stamps_[base + w] + 1;
+            if (stamp < best_stamp) {
+                best_stamp = stamp;
+                best = w;
+            }
+        }
+        return best;
+    }
+
+    void touch(uint32_t set, uint32_t way, uint64_t stamp) {
+        stamps_[idx(set, way)] = stamp;
+    }
+
+    void install(uint32_t set, uint32_t way, Address line, uint64_t stamp) {
+        size_t i = idx(set, way);
+        tags_[i] = line;
+        stamps_[i] = stamp;
+        dirty_[i] = 0;
+    }
+
+    [[nodiscard]] Address line(uint32_t set, uint32_t way) const { return tags_[idx(set, way)]; }
+    [[nodiscard]] bool valid(uint32_t set, uint32_t way) const { return tags_[idx(set, way)] != kInvalid; }
+    [[nodiscard]] bool dirty(uint32_t set, uint32_t way) const { return dirty_[idx(set, way)] != 0; }
+    void set_dirty(uint32_t set, uint32_t way) { dirty_[idx(set, way)] = 1; }
+    void clear_dirty(uint32_t set, uint32_t way) { dirty_[idx(set, way)] = 0; }
+
+    void invalidate_all() {
+        std::fill(tags_.begin(), tags_.end(), kInvalid);
+        std::fill(stamps_.begin(), stamps_.end(), 0);
+        std::fill(dirty_.begin(), dirty_.end(), 0);
+    }
+
+    [[nodiscard]] uint32_t sets() const { return sets_; }
+    [[nodiscard]] uint32_t ways() const { return ways_; }
+
+private:
+    [[nodiscard]] size_t idx(uint32_t set, uint32_t way) const {
+        return static_cast<size_t>(set) * ways_ + way;
+    }
+
+    uint32_t sets_;
+    uint32_t ways_;
+    std::vector<Address> tags_;
+    std::vector<uint64_t> stamps_;
+    std::vector<uint8_t> dirty_;
+};
+
+// ============================================================================
+// Cache Front-End
+// ============================================================================
+
+/// Set-associative cache layered over any memory controller
+///
+/// The cache implements IMemoryController itself, so it can be inserted in
+/// front of a controller of any fidelity without changing the requester.
+/// Hits complete after hit_latency cycles; misses allocate an MSHR and
+/// fetch the whole line from the backing controller, merging later misses
+/// to the same line. Dirty victims are written back (WRITE_BACK) or every
+/// write is forwarded (WRITE_THROUGH).
+///
+/// Requests spanning several lines are looked up line by line and complete
+/// when their last line does. Statistics reported through stats() are as
+/// seen by the requester; cache_stats() holds hit/miss/traffic counters and
+/// backing().stats() the DRAM-side view.
+class CacheController : public ControllerDecorator {
+public:
+    CacheController(const CacheConfig& config, std::unique_ptr<IMemoryController> backing);
+
+    std::optional<RequestId> submit(Request request) override;
+
+    [[nodiscard]] bool can_accept() const override;
+    [[nodiscard]] bool has_pending() const override;
+    [[nodiscard]] size_t pending_count() const override;
+
+    void tick() override;
+    void reset() override;
+
+    [[nodiscard]] Cycle cycle() const override { return current_cycle_; }
+    void set_cycle(Cycle c) override { current_cycle_ = c; backing_->set_cycle(c); }
+
+    [[nodiscard]] const Statistics& stats() const override { return stats_; }
+    [[nodiscard]] Statistics& stats() override { return stats_; }
+    void reset_stats() override { stats_.reset(); cache_stats_.reset(); }
+
+    // ========================================================================
+    // Cache-Specific Interface
+    // ========================================================================
+
+    [[nodiscard]] const CacheConfig& cache_config() const { return cache_config_; }
+    [[nodiscard]] const CacheStatistics& cache_stats() const { return cache_stats_; }
+
+    /// Write back all dirty lines (issued as memory writes)
+    void flush();
+
+private:
+    /// A requester access in flight through the cache
+    struct Access {
+        Request request;
+        Address next_line = 0;     ///< Next line to look up
+        Address end_line = 0;      ///< One past the last line
+        uint32_t lines_left = 0;   ///< Lines not yet completed
+    };
+
+    /// A line fill returned by the backing controller
+    struct Fill {
+        Cycle ready;
+        uint32_t mshr;
+
+        bool operator>(const Fill& other) const { return ready > other.ready; }
+    };
+
+    /// A hit waiting out the hit latency
+    struct HitCompletion {
+        Cycle ready;
+        uint32_t access;
+    };
+
+    [[nodiscard]] Address line_of(Address address) const { return address >> line_shift_; }
+    [[nodiscard]] Address address_of(Address line) const { return line << line_shift_; }
+
+    [[nodiscard]] bool allocates(RequestType type) const {
+        return type == RequestType::READ ||
+               cache_config_.allocate_policy == AllocatePolicy::WRITE_ALLOCATE;
+    }
+
+    void feed();
+    bool lookup(uint32_t access, Address line);
+    void install(uint32_t mshr);
+    void complete_line(uint32_t access);
+    void write_through(const Request& request, Address line);
+    void send_write(Address address, uint32_t size);
+    void issue_outbound();
+
+    CacheConfig cache_config_;
+
+    TagArray tags_;
+    MshrTable mshrs_;
+    std::vector<Cycle> mshr_issue_;        ///< Cycle each fill was accepted
+    Pool<Access> accesses_;
+    unsigned line_shift_;
+
+    std::deque<uint32_t> feeding_;         ///< Accesses with lines left to look up
+    std::deque<HitCompletion> hits_;
+    std::priority_queue<Fill, std::vector<Fill>, std::greater<Fill>> fills_;
+    std::deque<Request> outbound_;         ///< Writes waiting for the backing controller
+    std::deque<uint32_t> pending_fills_;   ///< MSHRs whose fill was not yet accepted
+
+    Cycle current_cycle_ = 0;
+    RequestId next_id_ = 1;
+    uint64_t stamp_ = 0;
+
+    Statistics stats_;
+    CacheStatistics cache_stats_;
+};
+
+} // namespace sw::memsim
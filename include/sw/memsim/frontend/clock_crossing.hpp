@@ -0,0 +1,93 @@
+#pragma once
+
+#include <sw/memsim/core/clock.hpp>
+#include <sw/memsim/frontend/controller_decorator.hpp>
+
+#include <algorithm>
+#include <memory>
+
+namespace sw::memsim {
+
+/// Clock-domain crossing between a requester and the memory controller
+///
+/// The requester ticks and reads cycle() in its own clock; every requester
+/// tick advances the backing controller by the memory cycles that elapse
+/// in that interval (8 memory cycles per 3 requester cycles for a 1.2 GHz
+/// accelerator on LPDDR5-6400), counted by a ClockStepper.
+///
+/// Completion callbacks receive latencies in requester cycles, counted to
+/// the first requester edge at or after the memory cycle the access
+/// completed in. Statistics and traces stay in memory cycles.
+///
+/// Cycle 0 of both clocks is aligned; set_cycle() takes requester cycles.
+class ClockCrossing : public ControllerDecorator {
+public:
+    ClockCrossing(const ClockDomain& requester, std::unique_ptr<IMemoryController> backing)
+        : ControllerDecorator(std::move(backing))
+        , requester_clock_(requester)
+        , to_memory_(requester.ratio_to(backing_->config().clock()))
+        , to_requester_(to_memory_.inverse())
+        , stepper_(to_memory_)
+    {
+        set_cycle(to_requester_.ceil(backing_->cycle()));
+    }
+
+    std::optional<RequestId> submit(Request request) override {
+        if (request.callback) {
+            request.callback = [callback = std::move(request.callback), to_requester = to_requester_,
+                                issued = cycle_, memory_issued = backing_->cycle()](Cycle latency) {
+                Cycle completed = std::max(to_requester.ceil(memory_issued + latency), issued);
+                callback(completed - issued);
+            };
+        }
+        return backing_->submit(std::move(request));
+    }
+
+    /// Advance one requester cycle
+    void tick() override {
+        cycle_++;
+        for (uint64_t edges = stepper_.step(); edges > 0; --edges) {
+            backing_->tick();
+        }
+    }
+
+    /// Advance `n` requester cycles
+    void tick(Cycle n) override {
+        Cycle target = to_memory_.floor(cycle_ + n) - to_memory_.floor(cycle_);
+        cycle_ += n;
+        stepper_.seek(cycle_);
+        backing_->tick(target);
+    }
+
+    void reset() override {
+        backing_->reset();
+        cycle_ = 0;
+        stepper_.seek(0);
+    }
+
+    /// Current requester cycle
+    [[nodiscard]] Cycle cycle() const override { return cycle_; }
+
+    /// Move to requester cycle `cycle` (the memory clock follows)
+    void set_cycle(Cycle cycle) override {
+        cycle_ = cycle;
+        stepper_.seek(cycle);
+        backing_->set_cycle(to_memory_.floor(cycle));
+    }
+
+    [[nodiscard]] Cycle memory_cycle() const { return backing_->cycle(); }
+    [[nodiscard]] const ClockDomain& requester_clock() const { return requester_clock_; }
+    [[nodiscard]] ClockDomain memory_clock() const { return backing_->config().clock(); }
+
+    /// Memory cycles per requester cycle
+    [[nodiscard]] const ClockRatio& ratio() const { return to_memory_; }
+
+private:
+    ClockDomain requester_clock_;
+    ClockRatio to_memory_;
+    ClockRatio to_requester_;
+    ClockStepper stepper_;
+    Cycle cycle_ = 0;
+};
+
+} // namespace sw::memsim
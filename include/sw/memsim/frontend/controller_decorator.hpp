@@ -0,0 +1,72 @@
+#pragma once
+
+#include <sw/memsim/interface/memory_controller.hpp>
+
+#include <memory>
+
+namespace sw::memsim {
+
+/// Base class for front-end stages layered over a memory controller
+///
+/// Every IMemoryController method is forwarded to the backing controller,
+/// so a stage (cache, read merger, prefetcher) only overrides the parts of
+/// the interface it changes. Stages can be stacked in any order.
+class ControllerDecorator : public IMemoryController {
+public:
+    explicit ControllerDecorator(std::unique_ptr<IMemoryController> backing)
+        : backing_(std::move(backing))
+    {}
+
+    std::optional<RequestId> submit(Request request) override {
+        return backing_->submit(std::move(request));
+    }
+
+    [[nodiscard]] bool can_accept() const override { return backing_->can_accept(); }
+    [[nodiscard]] bool has_pending() const override { return backing_->has_pending(); }
+    [[nodiscard]] size_t pending_count() const override { return backing_->pending_count(); }
+
+    void tick() override { backing_->tick(); }
+
+    void drain() override {
+        while (has_pending()) {
+            tick();
+        }
+    }
+
+    void reset() override { backing_->reset(); }
+
+    [[nodiscard]] Cycle cycle() const override { return backing_->cycle(); }
+    void set_cycle(Cycle c) override { backing_->set_cycle(c); }
+
+    [[nodiscard]] Fidelity fidelity() const override { return backing_->fidelity(); }
+    [[nodiscard]] Technology technology() const override { return backing_->technology(); }
+    [[nodiscard]] const ControllerConfig& config() const override { return backing_->config(); }
+
+    [[nodiscard]] BankState bank_state(Channel c, uint32_t b) const override { return backing_->bank_state(c, b); }
+    [[nodiscard]] bool is_row_open(Channel c, uint32_t b, Row r) const override { return backing_->is_row_open(c, b, r); }
+    [[nodiscard]] std::optional<Row> open_row(Channel c, uint32_t b) const override { return backing_->open_row(c, b); }
+    [[nodiscard]] Channel num_channels() const override { return backing_->num_channels(); }
+    [[nodiscard]] uint32_t banks_per_channel() const override { return backing_->banks_per_channel(); }
+
+    [[nodiscard]] const Statistics& stats() const override { return backing_->stats(); }
+    [[nodiscard]] Statistics& stats() override { return backing_->stats(); }
+    void reset_stats() override { backing_->reset_stats(); }
+
+    void enable_tracing(bool e) override { backing_->enable_tracing(e); }
+    [[nodiscard]] bool tracing_enabled() const override { return backing_->tracing_enabled(); }
+    void enable_invariants(bool e) override { backing_->enable_invariants(e); }
+    [[nodiscard]] bool invariants_enabled() const override { return backing_->invariants_enabled(); }
+
+    [[nodiscard]] const std::vector<Violation>& violations() const override { return backing_->violations(); }
+    [[nodiscard]] bool has_violations() const override { return backing_->has_violations(); }
+    void clear_violations() override { backing_->clear_violations(); }
+
+    /// The controller behind this stage
+    [[nodiscard]] IMemoryController& backing() { return *backing_; }
+    [[nodiscard]] const IMemoryController& backing() const { return *backing_; }
+
+protected:
+    std::unique_ptr<IMemoryController> backing_;
+};
+
+} // namespace sw::memsim
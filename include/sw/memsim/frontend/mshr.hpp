@@ -0,0 +1,107 @@
+#pragma once
+
+#include <sw/memsim/core/types.hpp>
+
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace sw::memsim {
+
+/// Miss Status Holding Register table
+///
+/// Tracks outstanding line fills keyed by line address. Each entry holds a
+/// bounded list of targets: opaque tokens (typically indices into the
+/// owner's pending-access pool) that are completed when the fill returns.
+/// Storage is allocated once at construction; entries are recycled through
+/// a free list.
+class MshrTable {
+public:
+    MshrTable(uint32_t entries, uint32_t targets_per_entry)
+        : max_targets_(targets_per_entry)
+        , lines_(entries, 0)
+        , target_counts_(entries, 0)
+        , targets_(static_cast<size_t>(entries) * targets_per_entry, 0)
+    {
+        free_.reserve(entries);
+        for (uint32_t i = entries; i > 0; --i) {
+            free_.push_back(i - 1);
+        }
+        index_.reserve(entries);
+    }
+
+    /// Find the entry tracking a line
+    [[nodiscard]] std::optional<uint32_t> find(Address line) const {
+        auto it = index_.find(line);
+        if (it == index_.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    /// Allocate an entry for a line (nullopt if the table is full)
+    std::optional<uint32_t> allocate(Address line) {
+        if (free_.empty()) {
+            return std::nullopt;
+        }
+        uint32_t id = free_.back();
+        free_.pop_back();
+        lines_[id] = line;
+        target_counts_[id] = 0;
+        index_.emplace(line, id);
+        return id;
+    }
+
+    /// Add a target to an entry (false if its target list is full)
+    bool add_target(uint32_t id, uint32_t token) {
+        if (target_counts_[id] >= max_targets_) {
+            return false;
+        }
+        targets_[static_cast<size_t>(id) * max_targets_ + target_counts_[id]++] = token;
+        return true;
+    }
+
+    /// Targets waiting on an entry, in arrival order
+    [[nodiscard]] std::span<const uint32_t> targets(uint32_t id) const {
+        return {targets_.data() + static_cast<size_t>(id) * max_targets_, target_counts_[id]};
+    }
+
+    [[nodiscard]] Address line(uint32_t id) const { return lines_[id]; }
+
+    [[nodiscard]] bool has_target_space(uint32_t id) const {
+        return target_counts_[id] < max_targets_;
+    }
+
+    /// Free an entry once its fill has been delivered
+    void release(uint32_t id) {
+        index_.erase(lines_[id]);
+        target_counts_[id] = 0;
+        free_.push_back(id);
+    }
+
+    void clear() {
+        index_.clear();
+        free_.clear();
+        for (uint32_t i = static_cast<uint32_t>(lines_.size()); i > 0; --i) {
+            target_counts_[i - 1] = 0;
+            free_.push_back(i - 1);
+        }
+    }
+
+    [[nodiscard]] size_t capacity() const { return lines_.size(); }
+    [[nodiscard]] size_t in_use() const { return lines_.size() - free_.size(); }
+    [[nodiscard]] size_t free_count() const { return free_.size(); }
+    [[nodiscard]] bool full() const { return free_.empty(); }
+    [[nodiscard]] bool empty() const { return free_.size() == lines_.size(); }
+
+private:
+    uint32_t max_targets_;
+    std::vector<Address> lines_;
+    std::vector<uint32_t> target_counts_;
+    std::vector<uint32_t> targets_;     ///< entries x max_targets, flattened
+    std::vector<uint32_t> free_;
+    std::unordered_map<Address, uint32_t> index_;
+};
+
+} // namespace sw::memsim
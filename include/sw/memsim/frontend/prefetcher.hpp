@@ -0,0 +1,182 @@
+#pragma once
+
+#include <sw/memsim/core/pool.hpp>
+#include <sw/memsim/frontend/controller_decorator.hpp>
+#include <sw/memsim/frontend/mshr.hpp>
+
+#include <deque>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+namespace sw::memsim {
+
+/// Prefetcher configuration
+struct PrefetchConfig {
+    bool stream = true;                  ///< Enable sequential stream detection
+    bool stride = true;                  ///< Enable constant-stride detection
+
+    uint32_t line_bytes = 64;            ///< Prefetch granularity (power of two)
+    uint32_t degree = 4;                 ///< Lines prefetched per trigger
+    uint32_t distance = 1;               ///< Lines ahead of the demand stream
+    uint32_t confidence = 2;             ///< Confirmations before prefetching
+
+    uint32_t streams_per_source = 4;     ///< Stream table entries per source
+    uint32_t max_sources = 64;           ///< Sources tracked (ids wrap modulo)
+
+    uint32_t buffer_lines = 64;          ///< Prefetched lines held for demand hits
+    uint32_t max_outstanding = 16;       ///< Prefetches in flight
+    uint32_t late_targets = 8;           ///< Demand reads waiting per in-flight prefetch
+    uint32_t hit_latency = 2;            ///< Prefetch buffer hit latency (cycles)
+    uint32_t queue_depth = 64;           ///< Demand reads served by the prefetcher
+};
+
+/// Prefetcher statistics
+struct PrefetchStatistics {
+    uint64_t issued = 0;          ///< Prefetches accepted by the backing controller
+    uint64_t dropped = 0;         ///< Prefetches not issued (no space downstream)
+    uint64_t useful = 0;          ///< Prefetched lines read by at least one demand
+    uint64_t late = 0;            ///< Useful prefetches still in flight at first use
+    uint64_t unused = 0;          ///< Prefetched lines evicted without use
+    uint64_t demand_reads = 0;
+    uint64_t covered = 0;         ///< Demand reads served by a prefetched line
+
+    /// Fraction of prefetches that were used
+    double accuracy() const {
+        return issued > 0 ? static_cast<double>(useful) / issued : 0.0;
+    }
+
+    /// Fraction of demand reads served by a prefetch
+    double coverage() const {
+        return demand_reads > 0 ? static_cast<double>(covered) / demand_reads : 0.0;
+    }
+
+    /// Fraction of useful prefetches that arrived after the demand
+    double lateness() const {
+        return useful > 0 ? static_cast<double>(late) / useful : 0.0;
+    }
+
+    void reset() {
+        *this = PrefetchStatistics{};
+    }
+};
+
+/// Stream and stride prefetch stage
+///
+/// Sits in front of any memory controller and observes demand reads per
+/// source (Request::source):
+/// - Stream detector: a small table of ascending/descending line streams
+///   per source; a confirmed stream prefetches the next `degree` lines
+/// - Stride detector: the last address and delta per source; a repeated
+///   delta of at least one line prefetches along the stride
+///
+/// Prefetches are injected at Priority::LOW, which the schedulers serve
+/// after demand requests of the same row-hit status, and dropped (not
+/// retried) when the backing controller has no space. Returned lines wait
+/// in a small prefetch buffer (FIFO replacement); a demand read to a
+/// buffered line completes after hit_latency, and a demand read to an
+/// in-flight prefetch waits for it (counted as late). Writes invalidate
+/// buffered lines; reads after a write to a line whose prefetch is in
+/// flight go to memory.
+///
+/// Detectors train on accepted demand reads only, so a rejected request
+/// that is retried does not train twice.
+class PrefetchController : public ControllerDecorator {
+public:
+    PrefetchController(const PrefetchConfig& config, std::unique_ptr<IMemoryController> backing);
+
+    std::optional<RequestId> submit(Request request) override;
+
+    [[nodiscard]] bool has_pending() const override;
+    [[nodiscard]] size_t pending_count() const override;
+
+    void tick() override;
+    void reset() override;
+
+    [[nodiscard]] const Statistics& stats() const override { return stats_; }
+    [[nodiscard]] Statistics& stats() override { return stats_; }
+    void reset_stats() override { stats_.reset(); prefetch_stats_.reset(); }
+
+    [[nodiscard]] const PrefetchConfig& prefetch_config() const { return prefetch_config_; }
+    [[nodiscard]] const PrefetchStatistics& prefetch_stats() const { return prefetch_stats_; }
+
+private:
+    /// Sequential stream tracked for one source
+    struct Stream {
+        Address last_line = 0;
+        int8_t direction = 0;      ///< +1, -1, or 0 while unconfirmed
+        uint8_t confidence = 0;
+        bool valid = false;
+        uint64_t lru = 0;
+    };
+
+    /// Stride history for one source
+    struct StrideEntry {
+        Address last = 0;
+        int64_t stride = 0;
+        uint8_t confidence = 0;
+        bool valid = false;
+    };
+
+    /// A prefetch fill returned by the backing controller
+    struct Fill {
+        Cycle ready;
+        uint32_t entry;
+
+        bool operator>(const Fill& other) const { return ready > other.ready; }
+    };
+
+    /// A demand read waiting out the buffer hit latency
+    struct HitCompletion {
+        Cycle ready;
+        uint32_t demand;
+    };
+
+    /// A line held in the prefetch buffer
+    struct BufferedLine {
+        uint64_t stamp;            ///< Matches ready_order_ entry while resident
+        bool used;
+    };
+
+    [[nodiscard]] Address line_of(Address address) const { return address >> line_shift_; }
+
+    std::optional<RequestId> submit_read(Request request);
+    std::optional<RequestId> serve(Request request, std::optional<uint32_t> inflight);
+    std::optional<RequestId> pass_through(Request request);
+
+    void train(uint32_t source, Address address);
+    void train_stream(uint32_t source, Address line);
+    void train_stride(uint32_t source, Address address);
+    void issue_prefetch(Address line);
+
+    void install(uint32_t entry);
+    void buffer(Address line, bool used);
+    void invalidate(Address line);
+    void complete_demand(uint32_t demand, Cycle latency);
+
+    PrefetchConfig prefetch_config_;
+    unsigned line_shift_;
+
+    std::vector<Stream> streams_;          ///< max_sources x streams_per_source
+    std::vector<StrideEntry> strides_;     ///< One per source
+    uint64_t lru_clock_ = 0;
+
+    MshrTable inflight_;                   ///< Prefetches in flight, late demands as targets
+    std::vector<Cycle> issue_cycle_;
+    std::vector<uint8_t> inflight_used_;
+    std::vector<uint8_t> inflight_stale_;  ///< Written while in flight: do not buffer
+
+    std::unordered_map<Address, BufferedLine> ready_;
+    std::deque<std::pair<Address, uint64_t>> ready_order_;   ///< FIFO (lazy deletion)
+    uint64_t buffer_stamp_ = 0;
+
+    Pool<Request> demands_;
+    std::deque<HitCompletion> hits_;
+    std::priority_queue<Fill, std::vector<Fill>, std::greater<Fill>> fills_;
+
+    RequestId next_id_ = 1;
+    Statistics stats_;
+    PrefetchStatistics prefetch_stats_;
+};
+
+} // namespace sw::memsim
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <sw/memsim/core/pool.hpp>
+#include <sw/memsim/frontend/controller_decorator.hpp>
+#include <sw/memsim/frontend/mshr.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <vector>
+
+namespace sw::memsim {
+
+/// Read merging configuration
+struct ReadMergeConfig {
+    uint32_t line_bytes = 64;      ///< Merge granularity (power of two)
+    uint32_t entries = 32;         ///< Outstanding lines tracked
+    uint32_t targets = 16;         ///< Reads merged per outstanding line
+    uint32_t queue_depth = 256;    ///< Tracked reads (primary + merged)
+};
+
+/// Outstanding-miss table at the controller input
+///
+/// A read whose bytes fall inside an outstanding read of the same line is
+/// not sent to memory; it is attached to the outstanding read and completes
+/// with it (fan-out). Typical source: several cores fetching the same
+/// broadcast weights. A write to a line closes its entry for merging so
+/// later reads observe the write.
+///
+/// Reads that cannot be tracked (spanning lines, table full) pass through
+/// to the backing controller unchanged.
+class ReadMerger : public ControllerDecorator {
+public:
+    ReadMerger(const ReadMergeConfig& config, std::unique_ptr<IMemoryController> backing)
+        : ControllerDecorator(std::move(backing))
+        , merge_config_(config)
+        , line_shift_(static_cast<unsigned>(std::countr_zero(config.line_bytes)))
+        , mshrs_(config.entries, config.targets)
+        , entries_(config.entries)
+        , accesses_(config.queue_depth)
+    {}
+
+    std::optional<RequestId> submit(Request request) override {
+        Address first = line_of(request.address);
+        Address last = line_of(request.address + std::max<uint32_t>(request.size, 1) - 1);
+
+        if (request.type == RequestType::WRITE) {
+            // Reads merging after this write would return stale data
+            for (Address line = first; line <= last; ++line) {
+                if (auto id = mshrs_.find(line)) {
+                    entries_[*id].mergeable = false;
+                }
+            }
+            return pass_through(std::move(request));
+        }
+
+        if (first != last || accesses_.full()) {
+            return pass_through(std::move(request));
+        }
+
+        if (auto id = mshrs_.find(first)) {
+            const Entry& entry = entries_[*id];
+            if (entry.mergeable && mshrs_.has_target_space(*id) &&
+                request.address >= entry.start &&
+                request.address + request.size <= entry.end) {
+                request.id = next_id_++;
+                request.submit_cycle = cycle();
+                Request* merged = accesses_.acquire(std::move(request));
+                mshrs_.add_target(*id, static_cast<uint32_t>(accesses_.index_of(merged)));
+                stats_.read_merges++;
+                return merged->id;
+            }
+            return pass_through(std::move(request));
+        }
+
+        if (mshrs_.full()) {
+            return pass_through(std::move(request));
+        }
+        return issue_primary(first, std::move(request));
+    }
+
+    [[nodiscard]] bool has_pending() const override {
+        return !accesses_.empty() || backing_->has_pending();
+    }
+
+    [[nodiscard]] size_t pending_count() const override {
+        return backing_->pending_count() + accesses_.in_use() - mshrs_.in_use();
+    }
+
+    void reset() override {
+        mshrs_.clear();
+        accesses_.clear();
+        next_id_ = 1;
+        stats_.reset();
+        backing_->reset();
+    }
+
+    [[nodiscard]] const Statistics& stats() const override { return stats_; }
+    [[nodiscard]] Statistics& stats() override { return stats_; }
+    void reset_stats() override { stats_.reset(); }
+
+    [[nodiscard]] const ReadMergeConfig& merge_config() const { return merge_config_; }
+
+    /// Lines with a read outstanding
+    [[nodiscard]] size_t outstanding_lines() const { return mshrs_.in_use(); }
+
+private:
+    /// Outstanding read tracked per MSHR entry
+    struct Entry {
+        Address start = 0;        ///< Bytes covered by the primary read
+        Address end = 0;
+        Cycle issue_cycle = 0;
+        bool mergeable = true;    ///< Cleared when a write hits the line
+    };
+
+    [[nodiscard]] Address line_of(Address address) const { return address >> line_shift_; }
+
+    std::optional<RequestId> issue_primary(Address line, Request request) {
+        if (!backing_->can_accept()) {
+            return std::nullopt;
+        }
+
+        uint32_t id = *mshrs_.allocate(line);
+        Entry& entry = entries_[id];
+        entry.start = request.address;
+        entry.end = request.address + request.size;
+        entry.issue_cycle = cycle();
+        entry.mergeable = true;
+
+        Request forward;
+        forward.address = request.address;
+        forward.size = request.size;
+        forward.type = request.type;
+        forward.priority = request.priority;
+        forward.callback = [this, id](Cycle latency) { complete(id, latency); };
+
+        request.id = next_id_++;
+        request.submit_cycle = cycle();
+        RequestId rid = request.id;
+        Request* primary = accesses_.acquire(std::move(request));
+        mshrs_.add_target(id, static_cast<uint32_t>(accesses_.index_of(primary)));
+
+        // May complete synchronously (e.g. behavioral backing)
+        if (!backing_->submit(std::move(forward))) {
+            accesses_.release(primary);
+            mshrs_.release(id);
+            next_id_--;
+            return std::nullopt;
+        }
+        return rid;
+    }
+
+    std::optional<RequestId> pass_through(Request request) {
+        RequestType type = request.type;
+        request.callback = [this, type, callback = std::move(request.callback)](Cycle latency) {
+            stats_.record_completion(type, latency);
+            if (callback) {
+                callback(latency);
+            }
+        };
+        if (!backing_->submit(std::move(request))) {
+            return std::nullopt;
+        }
+        return next_id_++;
+    }
+
+    void complete(uint32_t id, Cycle latency) {
+        Cycle done = entries_[id].issue_cycle + latency;
+
+        // Detach targets first so callbacks may issue new reads to this line
+        auto span = mshrs_.targets(id);
+        std::vector<uint32_t> targets(span.begin(), span.end());
+        mshrs_.release(id);
+
+        for (uint32_t idx : targets) {
+            Request* request = accesses_.at(idx);
+            Cycle target_latency = done - request->submit_cycle;
+            RequestType type = request->type;
+            CompletionCallback callback = std::move(request->callback);
+            accesses_.release(request);
+
+            stats_.record_completion(type, target_latency);
+            if (callback) {
+                callback(target_latency);
+            }
+        }
+    }
+
+    ReadMergeConfig merge_config_;
+    unsigned line_shift_;
+    MshrTable mshrs_;
+    std::vector<Entry> entries_;
+    Pool<Request> accesses_;
+    RequestId next_id_ = 1;
+    Statistics stats_;
+};
+
+} // namespace sw::memsim
@@ -3,9 +3,12 @@
 #include <sw/memsim/core/types.hpp>
 #include <sw/memsim/core/timing.hpp>
 #include <sw/memsim/core/statistics.hpp>
+#include <sw/memsim/core/checkpoint.hpp>
 
 #include <memory>
 #include <optional>
+#include <span>
+#include <string>
 #include <vector>
 
 namespace sw::memsim {
@@ -123,21 +126,27 @@ public:
 
     /// Get state of a specific bank
     ///
+    /// `bank` numbers the banks of all ranks of the channel (see
+    /// banks_per_channel()).
+    ///
     /// For BEHAVIORAL/TRANSACTIONAL: Returns simplified state
     /// For CYCLE_ACCURATE: Returns actual bank state
-    [[nodiscard]] virtual BankState bank_state(Channel channel, Bank bank) const = 0;
+    [[nodiscard]] virtual BankState bank_state(Channel channel, uint32_t bank) const = 0;
 
     /// Check if a specific row is open in a bank
-    [[nodiscard]] virtual bool is_row_open(Channel channel, Bank bank, Row row) const = 0;
+    [[nodiscard]] virtual bool is_row_open(Channel channel, uint32_t bank, Row row) const = 0;
 
     /// Get the currently open row in a bank (if any)
-    [[nodiscard]] virtual std::optional<Row> open_row(Channel channel, Bank bank) const = 0;
+    [[nodiscard]] virtual std::optional<Row> open_row(Channel channel, uint32_t bank) const = 0;
 
     /// Get number of channels
     [[nodiscard]] virtual Channel num_channels() const = 0;
 
-    /// Get number of banks per channel
-    [[nodiscard]] virtual Bank banks_per_channel() const = 0;
+    /// Get number of banks per channel (all ranks)
+    ///
+    /// Banks are numbered rank-major within a channel: bank b of rank r
+    /// is rank * banks_per_rank + b.
+    [[nodiscard]] virtual uint32_t banks_per_channel() const = 0;
 
     // ========================================================================
     // Statistics
@@ -178,7 +187,7 @@ public:
         std::string invariant_id;
         std::string message;
         Channel channel;
-        Bank bank;
+        uint32_t bank;       ///< Bank within the channel (see banks_per_channel())
     };
 
     /// Get list of invariant violations
@@ -189,6 +198,71 @@ public:
 
     /// Clear violation list
     virtual void clear_violations() = 0;
+
+    // ========================================================================
+    // Checkpointing
+    // ========================================================================
+
+    /// Independent deep copy of the controller, including in-flight requests
+    ///
+    /// The copy continues from the current cycle exactly as the original
+    /// would, so a sweep can branch from a common prefix instead of
+    /// replaying it. Completion callbacks of in-flight requests are copied,
+    /// so both branches invoke them.
+    ///
+    /// @return The copy, or nullptr if the controller cannot be cloned
+    [[nodiscard]] virtual std::unique_ptr<IMemoryController> clone() const {
+        return nullptr;
+    }
+
+    /// Serialize the complete simulation state
+    ///
+    /// Covers cycle, bank state machines, queued and in-flight requests,
+    /// scheduler buffers, RNG state and statistics. Completion callbacks
+    /// cannot be serialized: requests pending at checkpoint time complete
+    /// silently after a restore (they are still counted in statistics).
+    virtual void save_state([[maybe_unused]] CheckpointWriter& out) const {
+        throw CheckpointError("controller does not support checkpointing");
+    }
+
+    /// Restore state saved by save_state()
+    ///
+    /// The controller must have been built from the same configuration as
+    /// the one that was saved; geometry mismatches raise CheckpointError.
+    virtual void restore_state([[maybe_unused]] CheckpointReader& in) {
+        throw CheckpointError("controller does not support checkpointing");
+    }
+
+    /// Take a checkpoint into a memory buffer
+    [[nodiscard]] std::vector<uint8_t> checkpoint() const {
+        CheckpointWriter out;
+        out.write_header(fidelity(), technology());
+        save_state(out);
+        return out.take();
+    }
+
+    /// Restore from a checkpoint taken with checkpoint()
+    void restore(std::span<const uint8_t> data) {
+        CheckpointReader in(data);
+        in.read_header(fidelity(), technology());
+        restore_state(in);
+        if (!in.at_end()) {
+            throw CheckpointError("trailing data after checkpoint");
+        }
+    }
+
+    /// Take a checkpoint into a file
+    void save_checkpoint(const std::string& path) const {
+        CheckpointWriter out;
+        out.write_header(fidelity(), technology());
+        save_state(out);
+        out.save(path);
+    }
+
+    /// Restore from a checkpoint file
+    void load_checkpoint(const std::string& path) {
+        restore(CheckpointReader::load(path));
+    }
 };
 
 // ============================================================================
@@ -41,7 +41,7 @@ struct RefreshConfig {
     uint8_t max_postpone = 8;    ///< Maximum refresh postponement (multiples of tREFI)
     uint8_t max_pull_in = 8;     ///< Maximum refresh pull-in (for idle periods)
 
-    uint8_t num_banks = 16;      ///< Number of banks to manage
+    uint32_t num_banks = 16;     ///< Number of banks to manage
     uint8_t num_ranks = 1;       ///< Number of ranks
 };
 
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <sw/memsim/core/types.hpp>
+#include <sw/memsim/core/checkpoint.hpp>
 
+#include <functional>
 #include <memory>
 #include <span>
 #include <vector>
@@ -11,28 +13,6 @@ namespace sw::memsim {
 // Forward declaration
 class BankMachine;
 
-/// Scheduler policy types
-enum class SchedulerPolicy : uint8_t {
-    FIFO,           ///< Simple FIFO per bank
-    FR_FCFS,        ///< First-Ready FCFS (row hit priority)
-    FR_FCFS_GRP,    ///< FR-FCFS with R/W grouping
-    GRP_FR_FCFS,    ///< Grouping priority over row hits
-    GRP_FR_FCFS_WM, ///< Grouping with watermark thresholds
-    QOS_AWARE       ///< QoS-aware for mixed criticality
-};
-
-constexpr std::string_view to_string(SchedulerPolicy p) {
-    switch (p) {
-        case SchedulerPolicy::FIFO:          return "FIFO";
-        case SchedulerPolicy::FR_FCFS:       return "FR_FCFS";
-        case SchedulerPolicy::FR_FCFS_GRP:   return "FR_FCFS_GRP";
-        case SchedulerPolicy::GRP_FR_FCFS:   return "GRP_FR_FCFS";
-        case SchedulerPolicy::GRP_FR_FCFS_WM: return "GRP_FR_FCFS_WM";
-        case SchedulerPolicy::QOS_AWARE:     return "QOS_AWARE";
-        default: return "UNKNOWN";
-    }
-}
-
 /// Buffer organization types
 enum class BufferType : uint8_t {
     SHARED,         ///< Single shared buffer for all banks
@@ -53,7 +33,11 @@ struct SchedulerConfig {
     uint32_t high_watermark = 8;         ///< Switch to write when reads below
     uint32_t low_watermark = 4;          ///< Switch to read when writes below
 
-    uint8_t num_banks = 16;              ///< Number of banks
+    // Starvation control (FR-FCFS family)
+    uint32_t max_row_hit_streak = 0;     ///< Consecutive row hits per bank before FCFS (0 = unlimited)
+    Cycle max_request_age = 0;           ///< Age that forces the oldest request (0 = disabled)
+
+    uint32_t num_banks = 16;             ///< Number of banks (Request::bank_index range)
 };
 
 /// Abstract scheduler interface
@@ -90,6 +74,9 @@ public:
     /// Get buffer depth per bank
     [[nodiscard]] virtual std::span<const unsigned> buffer_depth() const = 0;
 
+    /// Inform the scheduler of the current cycle (for age-based policies)
+    virtual void set_cycle([[maybe_unused]] Cycle now) {}
+
     // ========================================================================
     // Request Selection
     // ========================================================================
@@ -102,24 +89,28 @@ public:
     /// - Request age (for fairness)
     /// - Request priority (for QoS)
     ///
-    /// @param bank The bank to select a request for
+    /// Requests are buffered by Request::bank_index, the controller's flat
+    /// bank index, so banks of different channels and ranks never share
+    /// a buffer.
+    ///
+    /// @param bank Flat index of the bank to select a request for
     /// @param open_row Currently open row (nullopt if bank is precharged)
     /// @param last_cmd Last command type issued (for grouping)
     /// @return Pointer to selected request, or nullptr if none available
     [[nodiscard]] virtual Request* get_next(
-        Bank bank,
+        BankIndex bank,
         std::optional<Row> open_row,
         RequestType last_cmd) const = 0;
 
     /// Check if there's another row hit pending for this bank/row
     [[nodiscard]] virtual bool has_row_hit(
-        Bank bank,
+        BankIndex bank,
         Row row,
         RequestType type) const = 0;
 
     /// Check if there are more requests pending for this bank
     [[nodiscard]] virtual bool has_pending(
-        Bank bank,
+        BankIndex bank,
         RequestType type) const = 0;
 
     /// Check if there are any requests pending for any bank
@@ -137,6 +128,38 @@ public:
 
     /// Get number of grouping decisions made
     [[nodiscard]] virtual uint64_t grouping_decisions() const = 0;
+
+    // ========================================================================
+    // Cloning and Checkpointing
+    // ========================================================================
+
+    /// Maps a buffered request to its slot in the owner's request pool
+    using RequestIndexer = std::function<uint32_t(const Request*)>;
+
+    /// Maps a pool slot back to the owner's request; throws
+    /// CheckpointError if the slot holds no live request
+    using RequestResolver = std::function<Request*(uint32_t)>;
+
+    /// Maps a request of the original owner to the same request in a copy
+    using RequestRemap = std::function<Request*(const Request*)>;
+
+    /// Copy the scheduler for a cloned owner, re-pointing buffered requests
+    [[nodiscard]] virtual std::unique_ptr<IScheduler> clone(
+        [[maybe_unused]] const RequestRemap& remap) const {
+        return nullptr;
+    }
+
+    /// Save buffered requests (as pool slots, in order) and policy state
+    virtual void save_state([[maybe_unused]] CheckpointWriter& out,
+                            [[maybe_unused]] const RequestIndexer& index_of) const {
+        throw CheckpointError("scheduler does not support checkpointing");
+    }
+
+    /// Restore state saved by save_state() into an empty scheduler
+    virtual void restore_state([[maybe_unused]] CheckpointReader& in,
+                               [[maybe_unused]] const RequestResolver& at) {
+        throw CheckpointError("scheduler does not support checkpointing");
+    }
 };
 
 // ============================================================================
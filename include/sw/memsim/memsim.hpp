@@ -66,8 +66,8 @@
 ///
 /// | Level | Speed | Accuracy | Use Case |
 /// |-------|-------|----------|----------|
-/// | BEHAVIORAL | ~1000x | Functional | Algorithm development |
-/// | TRANSACTIONAL | ~100x | Statistical | Early design exploration |
+/// | BEHAVIORAL | ~85x | Functional | Algorithm development |
+/// | TRANSACTIONAL | ~11x | Statistical | Early design exploration |
 /// | CYCLE_ACCURATE | 1x | Protocol | Detailed timing analysis |
 ///
 /// ## Supported Technologies
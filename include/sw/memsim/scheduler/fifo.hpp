@@ -1,16 +1,14 @@
 #pragma once
 
-#include <sw/memsim/interface/scheduler.hpp>
-
-#include <list>
-#include <vector>
+#include <sw/memsim/scheduler/request_buffers.hpp>
 
 namespace sw::memsim {
 
 /// Simple FIFO Scheduler
 ///
 /// The simplest scheduling policy: requests are served in the order
-/// they arrive, with no consideration for row buffer state.
+/// they arrive, with no consideration for row buffer state. Priority::LOW
+/// requests (prefetches) wait until no demand request is buffered.
 ///
 /// Advantages:
 /// - Maximum fairness (no starvation)
@@ -20,49 +18,40 @@ namespace sw::memsim {
 /// Disadvantages:
 /// - Poor row buffer utilization
 /// - Lower throughput than FR-FCFS
-class FifoScheduler : public IScheduler {
+class FifoScheduler final : public IScheduler {
 public:
+    /// Policy this scheduler implements
+    static constexpr SchedulerPolicy kPolicy = SchedulerPolicy::FIFO;
+
     explicit FifoScheduler(const SchedulerConfig& config)
         : config_(config)
-        , buffers_(config.num_banks)
-        , buffer_depths_(config.num_banks, 0)
+        , buffers_(config)
     {}
 
-    [[nodiscard]] bool has_space(unsigned count) const override {
-        return total_occupancy_ + count <= config_.buffer_size;
+    [[nodiscard]] bool has_space(unsigned count = 1) const override {
+        return buffers_.has_space(count);
     }
 
     void store(Request& request) override {
-        Bank bank = request.bank;
-        buffers_[bank].push_back(&request);
-        buffer_depths_[bank]++;
-        total_occupancy_++;
+        buffers_.store(request);
     }
 
     void remove(const Request& request) override {
-        Bank bank = request.bank;
-        auto& buffer = buffers_[bank];
+        BankIndex bank = request.bank_index;
 
-        for (auto it = buffer.begin(); it != buffer.end(); ++it) {
-            if ((*it)->id == request.id) {
-                buffer.erase(it);
-                buffer_depths_[bank]--;
-                total_occupancy_--;
-                return;
-            }
-        }
+        buffers_.remove(request);
     }
 
     [[nodiscard]] size_t occupancy() const override {
-        return total_occupancy_;
+        return buffers_.occupancy();
     }
 
     [[nodiscard]] std::span<const unsigned> buffer_depth() const override {
-        return buffer_depths_;
+        return buffers_.depths();
     }
 
     [[nodiscard]] Request* get_next(
-        Bank bank,
+        BankIndex bank,
         [[maybe_unused]] std::optional<Row> open_row,
         [[maybe_unused]] RequestType last_cmd) const override
     {
@@ -71,34 +60,55 @@ public:
             return nullptr;
         }
         const_cast<FifoScheduler*>(this)->requests_selected_++;
-        return buffer.front();
+        return RequestBuffers::oldest(buffer, [](const Request*) { return true; });
     }
 
     [[nodiscard]] bool has_row_hit(
-        [[maybe_unused]] Bank bank,
+        [[maybe_unused]] BankIndex bank,
         [[maybe_unused]] Row row,
         [[maybe_unused]] RequestType type) const override
     {
         return false;  // FIFO doesn't track row hits
     }
 
-    [[nodiscard]] bool has_pending(Bank bank, [[maybe_unused]] RequestType type) const override {
+    [[nodiscard]] bool has_pending(BankIndex bank, [[maybe_unused]] RequestType type) const override {
         return buffers_[bank].size() >= 2;
     }
 
     [[nodiscard]] bool has_any_pending() const override {
-        return total_occupancy_ > 0;
+        return buffers_.occupancy() > 0;
     }
 
     [[nodiscard]] uint64_t requests_selected() const override { return requests_selected_; }
     [[nodiscard]] uint64_t row_hits_selected() const override { return 0; }
     [[nodiscard]] uint64_t grouping_decisions() const override { return 0; }
 
+    [[nodiscard]] std::unique_ptr<IScheduler> clone(const RequestRemap& remap) const override {
+        return copy(remap);
+    }
+
+    /// clone() keeping the concrete type, for owners bound to it statically
+    [[nodiscard]] std::unique_ptr<FifoScheduler> copy(const RequestRemap& remap) const {
+        auto scheduler = std::make_unique<FifoScheduler>(*this);
+        scheduler->buffers_.remap(remap);
+        return scheduler;
+    }
+
+    void save_state(CheckpointWriter& out, const RequestIndexer& index_of) const override {
+        out.write(config_.policy);
+        buffers_.save(out, index_of);
+        out.write(requests_selected_);
+    }
+
+    void restore_state(CheckpointReader& in, const RequestResolver& at) override {
+        in.expect(config_.policy, "scheduler policy");
+        buffers_.restore(in, at);
+        requests_selected_ = in.read<uint64_t>();
+    }
+
 private:
     SchedulerConfig config_;
-    std::vector<std::list<Request*>> buffers_;
-    std::vector<unsigned> buffer_depths_;
-    size_t total_occupancy_ = 0;
+    RequestBuffers buffers_;
     mutable uint64_t requests_selected_ = 0;
 };
 
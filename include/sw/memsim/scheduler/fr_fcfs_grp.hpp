@@ -1,9 +1,7 @@
 #pragma once
 
-#include <sw/memsim/interface/scheduler.hpp>
+#include <sw/memsim/scheduler/request_buffers.hpp>
 
-#include <algorithm>
-#include <list>
 #include <vector>
 
 namespace sw::memsim {
@@ -27,52 +25,64 @@ namespace sw::memsim {
 /// 2. Among row hits, prefer same command type as last issued
 /// 3. Check for address hazards before selecting
 /// 4. Fall back to any row hit, then FCFS
-class FrFcfsGrpScheduler : public IScheduler {
+///
+/// Like FR-FCFS, row hits stop taking priority once a bank has served
+/// max_row_hit_streak consecutive hits, a request older than
+/// max_request_age is served unconditionally, and Priority::LOW requests
+/// (prefetches) are served in each step only when no demand request
+/// qualifies. A demand request never passes an older one to the same
+/// address.
+class FrFcfsGrpScheduler final : public IScheduler {
 public:
+    /// Policy this scheduler implements
+    static constexpr SchedulerPolicy kPolicy = SchedulerPolicy::FR_FCFS_GRP;
+
     explicit FrFcfsGrpScheduler(const SchedulerConfig& config)
         : config_(config)
-        , buffers_(config.num_banks)
-        , buffer_depths_(config.num_banks, 0)
+        , buffers_(config)
+        , last_row_(config.num_banks, 0)
+        , hit_streak_(config.num_banks, 0)
     {}
 
     // ========================================================================
     // Buffer Management
     // ========================================================================
 
-    [[nodiscard]] bool has_space(unsigned count) const override {
-        return total_occupancy_ + count <= config_.buffer_size;
+    [[nodiscard]] bool has_space(unsigned count = 1) const override {
+        return buffers_.has_space(count);
     }
 
     void store(Request& request) override {
-        Bank bank = request.bank;
-        buffers_[bank].push_back(&request);
-        buffer_depths_[bank]++;
-        total_occupancy_++;
+        buffers_.store(request);
     }
 
     void remove(const Request& request) override {
-        Bank bank = request.bank;
-        auto& buffer = buffers_[bank];
+        BankIndex bank = request.bank_index;
 
         // Track last command type for grouping
         last_command_ = request.type;
 
-        for (auto it = buffer.begin(); it != buffer.end(); ++it) {
-            if ((*it)->id == request.id) {
-                buffer.erase(it);
-                buffer_depths_[bank]--;
-                total_occupancy_--;
-                return;
-            }
+        // Track consecutive services to the same row for the streak cap
+        if (hit_streak_[bank] > 0 && last_row_[bank] == request.row) {
+            hit_streak_[bank]++;
+        } else {
+            hit_streak_[bank] = 1;
+            last_row_[bank] = request.row;
         }
+
+        buffers_.remove(request);
     }
 
     [[nodiscard]] size_t occupancy() const override {
-        return total_occupancy_;
+        return buffers_.occupancy();
     }
 
     [[nodiscard]] std::span<const unsigned> buffer_depth() const override {
-        return buffer_depths_;
+        return buffers_.depths();
+    }
+
+    void set_cycle(Cycle now) override {
+        now_ = now;
     }
 
     // ========================================================================
@@ -80,7 +90,7 @@ public:
     // ========================================================================
 
     [[nodiscard]] Request* get_next(
-        Bank bank,
+        BankIndex bank,
         std::optional<Row> open_row,
         [[maybe_unused]] RequestType last_cmd) const override
     {
@@ -89,6 +99,26 @@ public:
             return nullptr;
         }
 
+        // Oldest request waited too long: serve it regardless of row state
+        if (config_.max_request_age > 0 &&
+            now_ >= buffer.front()->submit_cycle + config_.max_request_age) {
+            const_cast<FrFcfsGrpScheduler*>(this)->age_overrides_++;
+            const_cast<FrFcfsGrpScheduler*>(this)->requests_selected_++;
+            return buffer.front();
+        }
+
+        // Row hit streak exhausted: serve the oldest request for another row
+        // (also while the bank is closed, so FCFS does not reopen the row)
+        if (streak_capped(bank, open_row)) {
+            for (auto* req : buffer) {
+                if (req->row != last_row_[bank]) {
+                    const_cast<FrFcfsGrpScheduler*>(this)->streak_breaks_++;
+                    const_cast<FrFcfsGrpScheduler*>(this)->requests_selected_++;
+                    return req;
+                }
+            }
+        }
+
         if (open_row.has_value()) {
             // Step 1: Filter all row hits
             std::vector<Request*> row_hits;
@@ -100,31 +130,34 @@ public:
 
             if (!row_hits.empty()) {
                 // Step 2: Among row hits, prefer same command type (grouping)
-                for (auto* req : row_hits) {
-                    if (req->type == last_command_) {
-                        // Step 3: Check for RAW/WAR hazards
-                        if (!has_address_hazard(row_hits, req)) {
-                            const_cast<FrFcfsGrpScheduler*>(this)->row_hits_++;
-                            const_cast<FrFcfsGrpScheduler*>(this)->grouping_decisions_++;
-                            const_cast<FrFcfsGrpScheduler*>(this)->requests_selected_++;
-                            return req;
-                        }
-                    }
+                // Step 3: Check for RAW/WAR hazards
+                Request* grouped = RequestBuffers::oldest(row_hits, [&](const Request* req) {
+                    return req->type == last_command_ && !has_address_hazard(row_hits, req);
+                });
+                if (grouped != nullptr) {
+                    const_cast<FrFcfsGrpScheduler*>(this)->row_hits_++;
+                    const_cast<FrFcfsGrpScheduler*>(this)->grouping_decisions_++;
+                    const_cast<FrFcfsGrpScheduler*>(this)->requests_selected_++;
+                    return grouped;
                 }
 
-                // No same-type hit without hazard, take first row hit
+                // No same-type hit without hazard, take the first row hit
                 const_cast<FrFcfsGrpScheduler*>(this)->row_hits_++;
                 const_cast<FrFcfsGrpScheduler*>(this)->requests_selected_++;
-                return row_hits.front();
+                return RequestBuffers::oldest(row_hits, [&](const Request* req) {
+                    return !has_address_hazard(row_hits, req);
+                });
             }
         }
 
         // No row hit found or bank precharged, return oldest (FCFS)
         const_cast<FrFcfsGrpScheduler*>(this)->requests_selected_++;
-        return buffer.front();
+        return RequestBuffers::oldest(buffer, [&](const Request* req) {
+            return !has_address_hazard(buffer, req);
+        });
     }
 
-    [[nodiscard]] bool has_row_hit(Bank bank, Row row, [[maybe_unused]] RequestType type) const override {
+    [[nodiscard]] bool has_row_hit(BankIndex bank, Row row, [[maybe_unused]] RequestType type) const override {
         unsigned hit_count = 0;
         for (auto* req : buffers_[bank]) {
             if (req->row == row) {
@@ -137,12 +170,12 @@ public:
         return false;
     }
 
-    [[nodiscard]] bool has_pending(Bank bank, [[maybe_unused]] RequestType type) const override {
+    [[nodiscard]] bool has_pending(BankIndex bank, [[maybe_unused]] RequestType type) const override {
         return buffers_[bank].size() >= 2;
     }
 
     [[nodiscard]] bool has_any_pending() const override {
-        return total_occupancy_ > 0;
+        return buffers_.occupancy() > 0;
     }
 
     // ========================================================================
@@ -153,12 +186,65 @@ public:
     [[nodiscard]] uint64_t row_hits_selected() const override { return row_hits_; }
     [[nodiscard]] uint64_t grouping_decisions() const override { return grouping_decisions_; }
 
+    /// Number of selections that broke a capped row hit streak
+    [[nodiscard]] uint64_t streak_breaks() const { return streak_breaks_; }
+
+    /// Number of selections forced by the request age threshold
+    [[nodiscard]] uint64_t age_overrides() const { return age_overrides_; }
+
+    // ========================================================================
+    // Cloning and Checkpointing
+    // ========================================================================
+
+    [[nodiscard]] std::unique_ptr<IScheduler> clone(const RequestRemap& remap) const override {
+        return copy(remap);
+    }
+
+    /// clone() keeping the concrete type, for owners bound to it statically
+    [[nodiscard]] std::unique_ptr<FrFcfsGrpScheduler> copy(const RequestRemap& remap) const {
+        auto scheduler = std::make_unique<FrFcfsGrpScheduler>(*this);
+        scheduler->buffers_.remap(remap);
+        return scheduler;
+    }
+
+    void save_state(CheckpointWriter& out, const RequestIndexer& index_of) const override {
+        out.write(config_.policy);
+        buffers_.save(out, index_of);
+        out.write(last_command_);
+        out.write_vector(last_row_);
+        out.write_vector(hit_streak_);
+        out.write(now_);
+        out.write(requests_selected_);
+        out.write(row_hits_);
+        out.write(streak_breaks_);
+        out.write(age_overrides_);
+        out.write(grouping_decisions_);
+    }
+
+    void restore_state(CheckpointReader& in, const RequestResolver& at) override {
+        in.expect(config_.policy, "scheduler policy");
+        buffers_.restore(in, at);
+        last_command_ = in.read<RequestType>();
+        in.read_vector_into(last_row_);
+        in.read_vector_into(hit_streak_);
+        now_ = in.read<Cycle>();
+        requests_selected_ = in.read<uint64_t>();
+        row_hits_ = in.read<uint64_t>();
+        streak_breaks_ = in.read<uint64_t>();
+        age_overrides_ = in.read<uint64_t>();
+        grouping_decisions_ = in.read<uint64_t>();
+    }
+
 private:
+    [[nodiscard]] bool streak_capped(BankIndex bank, std::optional<Row> open_row) const {
+        return config_.max_row_hit_streak > 0 &&
+               hit_streak_[bank] >= config_.max_row_hit_streak &&
+               (!open_row.has_value() || *open_row == last_row_[bank]);
+    }
+
     /// Check for RAW/WAR hazard between candidate and earlier requests
-    [[nodiscard]] bool has_address_hazard(
-        const std::vector<Request*>& candidates,
-        const Request* target) const
-    {
+    template <typename Range>
+    [[nodiscard]] static bool has_address_hazard(const Range& candidates, const Request* target) {
         for (auto* req : candidates) {
             if (req == target) {
                 break;  // Only check requests before target
@@ -171,16 +257,21 @@ private:
     }
 
     SchedulerConfig config_;
-    std::vector<std::list<Request*>> buffers_;
-    std::vector<unsigned> buffer_depths_;
-    size_t total_occupancy_ = 0;
+    RequestBuffers buffers_;
 
     RequestType last_command_ = RequestType::READ;
 
+    // Starvation control
+    std::vector<Row> last_row_;
+    std::vector<uint32_t> hit_streak_;
+    Cycle now_ = 0;
+
     // Statistics
     mutable uint64_t requests_selected_ = 0;
     mutable uint64_t row_hits_ = 0;
     mutable uint64_t grouping_decisions_ = 0;
+    mutable uint64_t streak_breaks_ = 0;
+    mutable uint64_t age_overrides_ = 0;
 };
 
 } // namespace sw::memsim
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <sw/memsim/interface/scheduler.hpp>
+
+#include <algorithm>
+#include <list>
+#include <span>
+#include <vector>
+
+namespace sw::memsim {
+
+/// Per-bank request buffers shared by the scheduler policies
+///
+/// Holds pointers into the owner's request pool, one FIFO list per flat
+/// bank index, under a total capacity of SchedulerConfig::buffer_size.
+/// Policies keep their own selection state and delegate buffering,
+/// cloning and checkpointing of the buffered requests here.
+class RequestBuffers {
+public:
+    explicit RequestBuffers(const SchedulerConfig& config)
+        : buffers_(config.num_banks)
+        , depths_(config.num_banks, 0)
+        , capacity_(config.buffer_size)
+    {}
+
+    [[nodiscard]] bool has_space(unsigned count) const {
+        return occupancy_ + count <= capacity_;
+    }
+
+    void store(Request& request) {
+        BankIndex bank = request.bank_index;
+        buffers_[bank].push_back(&request);
+        depths_[bank]++;
+        occupancy_++;
+    }
+
+    /// Remove the request with request.id from its bank's buffer
+    void remove(const Request& request) {
+        BankIndex bank = request.bank_index;
+        auto& buffer = buffers_[bank];
+        for (auto it = buffer.begin(); it != buffer.end(); ++it) {
+            if ((*it)->id == request.id) {
+                buffer.erase(it);
+                depths_[bank]--;
+                occupancy_--;
+                return;
+            }
+        }
+    }
+
+    /// Buffered requests of `bank`, oldest first
+    [[nodiscard]] const std::list<Request*>& operator[](BankIndex bank) const {
+        return buffers_[bank];
+    }
+
+    /// Oldest request of `candidates` (in age order) matching `match`,
+    /// preferring demand requests over Priority::LOW ones (prefetches);
+    /// nullptr if none matches
+    template <typename Range, typename Match>
+    [[nodiscard]] static Request* oldest(const Range& candidates, Match match) {
+        Request* low = nullptr;
+        for (Request* req : candidates) {
+            if (!match(req)) {
+                continue;
+            }
+            if (req->priority != Priority::LOW) {
+                return req;
+            }
+            if (low == nullptr) {
+                low = req;
+            }
+        }
+        return low;
+    }
+
+    [[nodiscard]] size_t occupancy() const { return occupancy_; }
+    [[nodiscard]] std::span<const unsigned> depths() const { return depths_; }
+
+    /// Re-point every buffered request for a cloned owner
+    void remap(const IScheduler::RequestRemap& remap) {
+        for (auto& buffer : buffers_) {
+            for (auto*& req : buffer) {
+                req = remap(req);
+            }
+        }
+    }
+
+    void save(CheckpointWriter& out, const IScheduler::RequestIndexer& index_of) const {
+        out.write<uint64_t>(buffers_.size());
+        for (const auto& buffer : buffers_) {
+            out.write<uint64_t>(buffer.size());
+            for (const Request* req : buffer) {
+                out.write(index_of(req));
+            }
+        }
+    }
+
+    /// Restore buffers saved by save(), rejecting requests that are over
+    /// capacity, in the wrong bank or buffered twice
+    void restore(CheckpointReader& in, const IScheduler::RequestResolver& at) {
+        in.expect<uint64_t>(buffers_.size(), "scheduler bank count");
+        occupancy_ = 0;
+        for (size_t bank = 0; bank < buffers_.size(); ++bank) {
+            auto& buffer = buffers_[bank];
+            buffer.clear();
+            auto depth = in.read<uint64_t>();
+            if (depth > capacity_ - occupancy_) {
+                throw CheckpointError("checkpoint scheduler buffer exceeds its capacity");
+            }
+            for (uint64_t i = 0; i < depth; ++i) {
+                Request* req = at(in.read<uint32_t>());
+                if (req->bank_index != bank ||
+                    std::find(buffer.begin(), buffer.end(), req) != buffer.end()) {
+                    throw CheckpointError("checkpoint scheduler buffer is corrupt");
+                }
+                buffer.push_back(req);
+            }
+            depths_[bank] = static_cast<unsigned>(depth);
+            occupancy_ += depth;
+        }
+    }
+
+private:
+    std::vector<std::list<Request*>> buffers_;
+    std::vector<unsigned> depths_;
+    size_t occupancy_ = 0;
+    size_t capacity_;
+};
+
+} // namespace sw::memsim
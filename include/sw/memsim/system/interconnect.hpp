@@ -0,0 +1,297 @@
+#pragma once
+
+#include <sw/memsim/frontend/controller_decorator.hpp>
+#include <sw/memsim/system/memory_system.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace sw::memsim {
+
+/// Parameters of one interconnect link (both directions)
+struct LinkConfig {
+    uint32_t latency = 0;             ///< Flight time in cycles, each direction
+    uint32_t bytes_per_cycle = 32;    ///< Bandwidth, each direction
+    uint32_t credits = 16;            ///< Request buffer entries at the memory side
+    uint32_t header_bytes = 16;       ///< Command/response header per packet
+};
+
+/// Traffic counters of one link
+struct LinkStats {
+    uint64_t requests = 0;
+    uint64_t request_bytes = 0;       ///< Headers plus write data
+    uint64_t response_bytes = 0;      ///< Headers plus read data
+    uint64_t request_busy_cycles = 0;
+    uint64_t response_busy_cycles = 0;
+    uint64_t credit_stalls = 0;       ///< Submits refused for lack of credits
+
+    double request_utilization(Cycle cycles) const {
+        return cycles > 0 ? static_cast<double>(request_busy_cycles) / cycles : 0.0;
+    }
+
+    double response_utilization(Cycle cycles) const {
+        return cycles > 0 ? static_cast<double>(response_busy_cycles) / cycles : 0.0;
+    }
+};
+
+// ============================================================================
+// Interconnect
+// ============================================================================
+
+/// Latency, bandwidth and flow-control model between sources and memory
+///
+/// Links connect request sources (Request::source) to the controllers of a
+/// MemorySystem; a die-to-die link shared by every core of a chiplet is one
+/// link routed from several sources. A request crossing a link:
+/// 1. needs a credit (a free request buffer entry at the memory side);
+///    without one submit() fails and the source retries later
+/// 2. is serialized onto the link (header plus write data at
+///    bytes_per_cycle) and flies for `latency` cycles
+/// 3. waits in the buffer, in order, until its controller accepts it,
+///    which returns the credit
+/// 4. once memory completes it, the response (header plus read data)
+///    crosses back the same way
+///
+/// Callbacks receive the end-to-end latency in cycles. Source/controller
+/// pairs without a link reach memory directly.
+class Interconnect : public ControllerDecorator {
+public:
+    explicit Interconnect(std::unique_ptr<MemorySystem> system)
+        : ControllerDecorator(std::move(system))
+        , system_(static_cast<MemorySystem&>(*backing_))
+    {}
+
+    // ========================================================================
+    // Topology
+    // ========================================================================
+
+    /// Add a link; returns its index
+    uint32_t add_link(const LinkConfig& config) {
+        if (config.bytes_per_cycle == 0 || config.credits == 0) {
+            throw std::invalid_argument("link needs bandwidth and at least one credit");
+        }
+        links_.emplace_back();
+        links_.back().config = config;
+        return static_cast<uint32_t>(links_.size() - 1);
+    }
+
+    /// Carry traffic from `source` to `controller` over `link`
+    void route(uint16_t source, uint32_t controller, uint32_t link) {
+        if (link >= links_.size() || controller >= system_.num_controllers()) {
+            throw std::invalid_argument("route refers to a missing link or controller");
+        }
+        routes_[{source, controller}] = link;
+    }
+
+    /// Link used between a source and a controller, if any
+    [[nodiscard]] std::optional<uint32_t> link_of(uint16_t source, uint32_t controller) const {
+        auto it = routes_.find({source, controller});
+        if (it == routes_.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    // ========================================================================
+    // IMemoryController
+    // ========================================================================
+
+    std::optional<RequestId> submit(Request request) override {
+        auto link_id = link_of(request.source, system_.route_of(request.address).controller);
+        if (!link_id) {
+            if (!backing_->submit(std::move(request))) {
+                return std::nullopt;
+            }
+            return next_id_++;
+        }
+
+        Link& link = links_[*link_id];
+        if (link.credits_used == link.config.credits) {
+            link.stats.credit_stalls++;
+            return std::nullopt;
+        }
+        link.credits_used++;
+
+        const uint32_t bytes = link.config.header_bytes +
+            (request.type == RequestType::WRITE ? request.size : 0);
+        const Cycle sent = serialize(link.request_free, cycle(), bytes, link.config,
+                                     link.stats.request_busy_cycles);
+        link.stats.requests++;
+        link.stats.request_bytes += bytes;
+
+        const uint32_t slot = acquire_slot();
+        Transfer& transfer = transfers_[slot];
+        transfer.callback = std::move(request.callback);
+        transfer.link = *link_id;
+        transfer.issued = cycle();
+        transfer.response_bytes = link.config.header_bytes +
+            (request.type == RequestType::READ ? request.size : 0);
+
+        request.callback = [this, slot](Cycle latency) { respond(slot, latency); };
+        link.buffer.push_back({sent + link.config.latency, slot, std::move(request)});
+        in_flight_++;
+        return next_id_++;
+    }
+
+    /// Whether any request could be sent now (ignores per-link credits)
+    [[nodiscard]] bool can_accept() const override { return backing_->can_accept(); }
+
+    [[nodiscard]] bool has_pending() const override {
+        return in_flight_ > 0 || backing_->has_pending();
+    }
+
+    [[nodiscard]] size_t pending_count() const override {
+        return in_flight_ + backing_->pending_count();
+    }
+
+    void tick() override {
+        backing_->tick();
+        const Cycle now = cycle();
+        for (Link& link : links_) {
+            deliver(link, now);
+        }
+        while (!responses_.empty() && responses_.top().arrival <= now) {
+            Response response = responses_.top();
+            responses_.pop();
+            complete(response);
+        }
+    }
+
+    void reset() override {
+        backing_->reset();
+        for (Link& link : links_) {
+            link.buffer.clear();
+            link.credits_used = 0;
+            link.request_free = 0;
+            link.response_free = 0;
+            link.stats = LinkStats{};
+        }
+        responses_ = {};
+        transfers_.clear();
+        free_.clear();
+        in_flight_ = 0;
+    }
+
+    // ========================================================================
+    // Statistics
+    // ========================================================================
+
+    [[nodiscard]] size_t num_links() const { return links_.size(); }
+    [[nodiscard]] const LinkStats& link_stats(uint32_t link) const { return links_.at(link).stats; }
+    [[nodiscard]] uint32_t credits_available(uint32_t link) const {
+        return links_.at(link).config.credits - links_.at(link).credits_used;
+    }
+
+    [[nodiscard]] MemorySystem& system() { return system_; }
+
+private:
+    struct Packet {
+        Cycle arrival;
+        uint32_t slot;                        ///< Transfer of the request
+        Request request;
+    };
+
+    struct Link {
+        LinkConfig config;
+        std::deque<Packet> buffer;            ///< Requests in flight or waiting for memory
+        uint32_t credits_used = 0;
+        Cycle request_free = 0;               ///< First cycle the request direction is idle
+        Cycle response_free = 0;
+        LinkStats stats;
+    };
+
+    struct Transfer {
+        CompletionCallback callback;
+        uint32_t link = 0;
+        Cycle issued = 0;
+        Cycle delivered = 0;                  ///< Cycle memory accepted the request
+        uint32_t response_bytes = 0;
+    };
+
+    struct Response {
+        Cycle arrival;
+        uint32_t slot;
+
+        bool operator>(const Response& other) const {
+            return arrival != other.arrival ? arrival > other.arrival : slot > other.slot;
+        }
+    };
+
+    /// Serialize `bytes` onto one direction of a link, no earlier than
+    /// `earliest`; returns the cycle the last byte leaves
+    static Cycle serialize(Cycle& free, Cycle earliest, uint32_t bytes, const LinkConfig& config,
+                           uint64_t& busy) {
+        const Cycle cycles = (bytes + config.bytes_per_cycle - 1) / config.bytes_per_cycle;
+        free = std::max(free, earliest) + cycles;
+        busy += cycles;
+        return free;
+    }
+
+    /// Hand arrived requests to memory, in order, until one is refused
+    void deliver(Link& link, Cycle now) {
+        while (!link.buffer.empty() && link.buffer.front().arrival <= now) {
+            // Set before submitting: behavioral controllers answer inside submit()
+            transfers_[link.buffer.front().slot].delivered = now;
+            if (!backing_->submit(link.buffer.front().request)) {
+                return;
+            }
+            link.buffer.pop_front();
+            link.credits_used--;
+        }
+    }
+
+    /// Memory finished a linked request: send the response back
+    ///
+    /// Controllers report latency from their own submit, so the data is
+    /// ready at the delivery cycle plus `latency` whenever the callback runs.
+    void respond(uint32_t slot, Cycle latency) {
+        Transfer& transfer = transfers_[slot];
+        Link& link = links_[transfer.link];
+        const Cycle ready = transfer.delivered + latency;
+        const Cycle sent = serialize(link.response_free, ready, transfer.response_bytes,
+                                     link.config, link.stats.response_busy_cycles);
+        link.stats.response_bytes += transfer.response_bytes;
+        responses_.push({sent + link.config.latency, slot});
+    }
+
+    void complete(const Response& response) {
+        Transfer& transfer = transfers_[response.slot];
+        CompletionCallback callback = std::move(transfer.callback);
+        const Cycle latency = response.arrival - transfer.issued;
+        free_.push_back(response.slot);
+        in_flight_--;
+        if (callback) {
+            callback(latency);
+        }
+    }
+
+    uint32_t acquire_slot() {
+        if (free_.empty()) {
+            transfers_.emplace_back();
+            return static_cast<uint32_t>(transfers_.size() - 1);
+        }
+        uint32_t slot = free_.back();
+        free_.pop_back();
+        return slot;
+    }
+
+    MemorySystem& system_;
+    std::vector<Link> links_;
+    std::map<std::pair<uint16_t, uint32_t>, uint32_t> routes_;
+
+    std::vector<Transfer> transfers_;             ///< Indexed by callback slot
+    std::vector<uint32_t> free_;
+    std::priority_queue<Response, std::vector<Response>, std::greater<>> responses_;
+    size_t in_flight_ = 0;                        ///< Linked requests not yet answered
+    RequestId next_id_ = 1;
+};
+
+} // namespace sw::memsim
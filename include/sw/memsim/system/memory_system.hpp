@@ -0,0 +1,424 @@
+#pragma once
+
+#include <sw/memsim/interface/memory_controller.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace sw::memsim {
+
+// ============================================================================
+// Global Address Map
+// ============================================================================
+
+/// Contiguous range of the global address space
+///
+/// The region is striped across its controllers in `interleave_bytes`
+/// granules, in the order the controllers are listed. A region with a
+/// single controller maps it linearly.
+struct MemoryRegion {
+    Address base = 0;
+    Address size = 0;
+    std::vector<uint32_t> controllers;      ///< Indices into the memory system
+    uint64_t interleave_bytes = 4096;       ///< Granule (power of two)
+};
+
+/// Controller and controller-local address of a global address
+struct Route {
+    uint32_t controller = 0;
+    Address local = 0;
+};
+
+/// Global address map of a memory system
+///
+/// Each controller's share of every region it serves is packed into its
+/// local address space in the order regions were added, so a controller
+/// can back several regions.
+class AddressMap {
+public:
+    /// Add a region; regions must not overlap
+    void add(const MemoryRegion& region) {
+        if (region.size == 0 || region.controllers.empty()) {
+            throw std::invalid_argument("memory region needs a size and at least one controller");
+        }
+        if (!std::has_single_bit(region.interleave_bytes)) {
+            throw std::invalid_argument("interleave granularity must be a power of two");
+        }
+        for (const Entry& entry : regions_) {
+            if (region.base < entry.region.base + entry.region.size &&
+                entry.region.base < region.base + region.size) {
+                throw std::invalid_argument("memory regions overlap");
+            }
+        }
+
+        Entry entry;
+        entry.region = region;
+        entry.shift = static_cast<unsigned>(std::countr_zero(region.interleave_bytes));
+        // Each controller holds ceil(granules / n) granules of the region
+        const uint64_t n = region.controllers.size();
+        const uint64_t granules = (region.size + region.interleave_bytes - 1) >> entry.shift;
+        const Address share = ((granules + n - 1) / n) << entry.shift;
+        for (uint32_t controller : region.controllers) {
+            if (controller >= used_.size()) {
+                used_.resize(controller + 1, 0);
+            }
+            entry.local_base.push_back(used_[controller]);
+            used_[controller] += share;
+        }
+
+        auto pos = std::upper_bound(regions_.begin(), regions_.end(), region.base,
+            [](Address base, const Entry& e) { return base < e.region.base; });
+        regions_.insert(pos, std::move(entry));
+    }
+
+    /// Route a global address, or nullopt if it is not mapped
+    [[nodiscard]] std::optional<Route> route(Address address) const {
+        auto it = std::upper_bound(regions_.begin(), regions_.end(), address,
+            [](Address a, const Entry& e) { return a < e.region.base; });
+        if (it == regions_.begin()) {
+            return std::nullopt;
+        }
+        const Entry& entry = *--it;
+        const Address offset = address - entry.region.base;
+        if (offset >= entry.region.size) {
+            return std::nullopt;
+        }
+
+        const uint64_t n = entry.region.controllers.size();
+        const uint64_t granule = offset >> entry.shift;
+        const uint64_t way = granule % n;
+        const Address within = offset & (entry.region.interleave_bytes - 1);
+        return Route{entry.region.controllers[way],
+                     entry.local_base[way] + ((granule / n) << entry.shift) + within};
+    }
+
+    /// Bytes of local address space each controller needs
+    [[nodiscard]] Address footprint(uint32_t controller) const {
+        return controller < used_.size() ? used_[controller] : 0;
+    }
+
+    [[nodiscard]] size_t num_regions() const { return regions_.size(); }
+    [[nodiscard]] const MemoryRegion& region(size_t index) const { return regions_.at(index).region; }
+
+private:
+    struct Entry {
+        MemoryRegion region;
+        unsigned shift = 0;
+        std::vector<Address> local_base;    ///< Per listed controller
+    };
+
+    std::vector<Entry> regions_;            ///< Sorted by base
+    std::vector<Address> used_;             ///< Local bytes allocated per controller
+};
+
+// ============================================================================
+// Memory System
+// ============================================================================
+
+/// Several memory controllers behind one global address map
+///
+/// Requests are routed by their start address to one controller, with the
+/// address translated into that controller's local space; a request should
+/// not straddle an interleave granule. Controllers may differ in technology
+/// and fidelity (e.g. HBM for weights next to LPDDR for activations). All
+/// of them are ticked together, so controllers on other clocks should be
+/// wrapped in a ClockCrossing on the system clock.
+///
+/// The system is itself an IMemoryController. Channels are numbered
+/// globally: the first controller's channels come first. stats() merges
+/// every controller's statistics; per-controller statistics are available
+/// through controller(). config(), fidelity() and technology() describe the
+/// first controller, with the channel count and queue depth of the system.
+class MemorySystem : public IMemoryController {
+public:
+    MemorySystem(std::vector<std::unique_ptr<IMemoryController>> controllers, AddressMap map)
+        : controllers_(std::move(controllers))
+        , map_(std::move(map))
+    {
+        if (controllers_.empty()) {
+            throw std::invalid_argument("memory system needs at least one controller");
+        }
+        for (size_t i = 0; i < controllers_.size(); ++i) {
+            if (!controllers_[i]) {
+                throw std::invalid_argument("memory system controller is null");
+            }
+        }
+        for (size_t r = 0; r < map_.num_regions(); ++r) {
+            for (uint32_t c : map_.region(r).controllers) {
+                if (c >= controllers_.size()) {
+                    throw std::invalid_argument("memory region refers to a missing controller");
+                }
+            }
+        }
+
+        config_ = controllers_.front()->config();
+        config_.queue_depth = 0;
+        Channel channels = 0;
+        for (const auto& controller : controllers_) {
+            channel_base_.push_back(channels);
+            channels = static_cast<Channel>(channels + controller->num_channels());
+            config_.queue_depth += controller->config().queue_depth;
+        }
+        config_.organization.num_channels = channels;
+        cycle_ = controllers_.front()->cycle();
+    }
+
+    // ========================================================================
+    // Request Interface
+    // ========================================================================
+
+    /// Route a request to its controller
+    ///
+    /// @throws std::invalid_argument if the address is not mapped
+    std::optional<RequestId> submit(Request request) override {
+        const Route route = route_of(request.address);
+        request.address = route.local;
+        if (!controllers_[route.controller]->submit(std::move(request))) {
+            return std::nullopt;
+        }
+        return next_id_++;
+    }
+
+    /// True only if every controller can accept (see can_accept(Address))
+    [[nodiscard]] bool can_accept() const override {
+        return std::all_of(controllers_.begin(), controllers_.end(),
+                           [](const auto& c) { return c->can_accept(); });
+    }
+
+    /// Whether the controller serving `address` can accept a request
+    [[nodiscard]] bool can_accept(Address address) const {
+        return controllers_[route_of(address).controller]->can_accept();
+    }
+
+    [[nodiscard]] bool has_pending() const override {
+        return std::any_of(controllers_.begin(), controllers_.end(),
+                           [](const auto& c) { return c->has_pending(); });
+    }
+
+    [[nodiscard]] size_t pending_count() const override {
+        size_t count = 0;
+        for (const auto& controller : controllers_) {
+            count += controller->pending_count();
+        }
+        return count;
+    }
+
+    // ========================================================================
+    // Simulation Interface
+    // ========================================================================
+
+    void tick() override {
+        for (auto& controller : controllers_) {
+            controller->tick();
+        }
+        cycle_++;
+    }
+
+    void drain() override {
+        while (has_pending()) {
+            tick();
+        }
+    }
+
+    void reset() override {
+        for (auto& controller : controllers_) {
+            controller->reset();
+        }
+        cycle_ = 0;
+        next_id_ = 1;
+    }
+
+    [[nodiscard]] Cycle cycle() const override { return cycle_; }
+
+    void set_cycle(Cycle cycle) override {
+        for (auto& controller : controllers_) {
+            controller->set_cycle(cycle);
+        }
+        cycle_ = cycle;
+    }
+
+    // ========================================================================
+    // Configuration and Bank State
+    // ========================================================================
+
+    [[nodiscard]] Fidelity fidelity() const override { return controllers_.front()->fidelity(); }
+    [[nodiscard]] Technology technology() const override { return controllers_.front()->technology(); }
+    [[nodiscard]] const ControllerConfig& config() const override { return config_; }
+
+    [[nodiscard]] BankState bank_state(Channel channel, uint32_t bank) const override {
+        auto [c, local] = locate(channel);
+        return controllers_[c]->bank_state(local, bank);
+    }
+
+    [[nodiscard]] bool is_row_open(Channel channel, uint32_t bank, Row row) const override {
+        auto [c, local] = locate(channel);
+        return controllers_[c]->is_row_open(local, bank, row);
+    }
+
+    [[nodiscard]] std::optional<Row> open_row(Channel channel, uint32_t bank) const override {
+        auto [c, local] = locate(channel);
+        return controllers_[c]->open_row(local, bank);
+    }
+
+    [[nodiscard]] Channel num_channels() const override { return config_.organization.num_channels; }
+    [[nodiscard]] uint32_t banks_per_channel() const override { return controllers_.front()->banks_per_channel(); }
+
+    // ========================================================================
+    // Statistics and Observability
+    // ========================================================================
+
+    /// Statistics of all controllers, merged
+    [[nodiscard]] const Statistics& stats() const override {
+        merged_.reset();
+        for (const auto& controller : controllers_) {
+            merged_.merge(controller->stats());
+        }
+        return merged_;
+    }
+
+    /// Merged snapshot; changes do not reach the controllers
+    [[nodiscard]] Statistics& stats() override {
+        std::as_const(*this).stats();
+        return merged_;
+    }
+
+    void reset_stats() override {
+        for (auto& controller : controllers_) {
+            controller->reset_stats();
+        }
+    }
+
+    void enable_tracing(bool enable) override {
+        for (auto& controller : controllers_) {
+            controller->enable_tracing(enable);
+        }
+    }
+
+    [[nodiscard]] bool tracing_enabled() const override { return controllers_.front()->tracing_enabled(); }
+
+    void enable_invariants(bool enable) override {
+        for (auto& controller : controllers_) {
+            controller->enable_invariants(enable);
+        }
+    }
+
+    [[nodiscard]] bool invariants_enabled() const override { return controllers_.front()->invariants_enabled(); }
+
+    /// Violations of all controllers, with global channel numbers
+    [[nodiscard]] const std::vector<Violation>& violations() const override {
+        violations_.clear();
+        for (size_t c = 0; c < controllers_.size(); ++c) {
+            for (Violation v : controllers_[c]->violations()) {
+                v.channel = static_cast<Channel>(v.channel + channel_base_[c]);
+                violations_.push_back(std::move(v));
+            }
+        }
+        return violations_;
+    }
+
+    [[nodiscard]] bool has_violations() const override {
+        return std::any_of(controllers_.begin(), controllers_.end(),
+                           [](const auto& c) { return c->has_violations(); });
+    }
+
+    void clear_violations() override {
+        for (auto& controller : controllers_) {
+            controller->clear_violations();
+        }
+    }
+
+    // ========================================================================
+    // Checkpointing
+    // ========================================================================
+
+    /// Clone of every controller; nullptr if any of them cannot be cloned
+    [[nodiscard]] std::unique_ptr<IMemoryController> clone() const override {
+        std::vector<std::unique_ptr<IMemoryController>> copies;
+        for (const auto& controller : controllers_) {
+            copies.push_back(controller->clone());
+            if (!copies.back()) {
+                return nullptr;
+            }
+        }
+        auto copy = std::make_unique<MemorySystem>(std::move(copies), map_);
+        copy->cycle_ = cycle_;
+        copy->next_id_ = next_id_;
+        return copy;
+    }
+
+    void save_state(CheckpointWriter& out) const override {
+        out.write(cycle_);
+        out.write(next_id_);
+        out.write<uint64_t>(controllers_.size());
+        for (const auto& controller : controllers_) {
+            out.write_header(controller->fidelity(), controller->technology());
+            controller->save_state(out);
+        }
+    }
+
+    void restore_state(CheckpointReader& in) override {
+        cycle_ = in.read<Cycle>();
+        next_id_ = in.read<RequestId>();
+        in.expect<uint64_t>(controllers_.size(), "controller count");
+        for (auto& controller : controllers_) {
+            in.read_header(controller->fidelity(), controller->technology());
+            controller->restore_state(in);
+        }
+    }
+
+    // ========================================================================
+    // Topology
+    // ========================================================================
+
+    [[nodiscard]] size_t num_controllers() const { return controllers_.size(); }
+    [[nodiscard]] IMemoryController& controller(size_t index) { return *controllers_.at(index); }
+    [[nodiscard]] const IMemoryController& controller(size_t index) const { return *controllers_.at(index); }
+    [[nodiscard]] const AddressMap& address_map() const { return map_; }
+
+    /// First global channel number of a controller
+    [[nodiscard]] Channel channel_base(size_t index) const { return channel_base_.at(index); }
+
+    /// Controller and local address serving a global address
+    ///
+    /// @throws std::invalid_argument if the address is not mapped
+    [[nodiscard]] Route route_of(Address address) const {
+        auto route = map_.route(address);
+        if (!route) {
+            throw std::invalid_argument("address is not mapped to any memory region");
+        }
+        return *route;
+    }
+
+private:
+    struct LocalChannel {
+        size_t controller;
+        Channel channel;
+    };
+
+    /// @throws std::invalid_argument if the channel is past num_channels()
+    [[nodiscard]] LocalChannel locate(Channel channel) const {
+        if (channel >= num_channels()) {
+            throw std::invalid_argument("channel is not served by any controller");
+        }
+        auto it = std::upper_bound(channel_base_.begin(), channel_base_.end(), channel);
+        size_t c = static_cast<size_t>(it - channel_base_.begin()) - 1;
+        return {c, static_cast<Channel>(channel - channel_base_[c])};
+    }
+
+    std::vector<std::unique_ptr<IMemoryController>> controllers_;
+    AddressMap map_;
+    ControllerConfig config_;
+    std::vector<Channel> channel_base_;
+    Cycle cycle_ = 0;
+    RequestId next_id_ = 1;
+
+    mutable Statistics merged_;
+    mutable std::vector<Violation> violations_;
+};
+
+} // namespace sw::memsim
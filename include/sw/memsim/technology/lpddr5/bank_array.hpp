@@ -0,0 +1,191 @@
+#pragma once
+
+#include <sw/memsim/core/aligned_allocator.hpp>
+#include <sw/memsim/core/checkpoint.hpp>
+#include <sw/memsim/core/types.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace sw::memsim::lpddr5 {
+
+/// LPDDR5 bank state machines, one array per field
+///
+/// Bank i is element i of every array. The per-cycle expiry sweep,
+/// update(), reads only state, state_until, precharge_until and
+/// auto_precharge, which are all 64-bit so the sweep works on uniform
+/// lanes. It applies every transition with compares and masks instead of
+/// a per-bank switch; GCC vectorizes it when the target has 64-bit vector
+/// compares (SSE4.2, AVX2), otherwise it stays a branch-free scalar loop.
+/// It is skipped entirely until the earliest pending expiry.
+///
+/// Transient states (ACTIVATING, READING, WRITING, PRECHARGING,
+/// REFRESHING) must be entered through enter() so the expiry bound stays
+/// valid; the timing fields may be written directly. open_row is only
+/// meaningful while the bank is ACTIVE.
+class LPDDR5BankArray {
+public:
+    static constexpr Cycle kNever = std::numeric_limits<Cycle>::max();
+
+    /// BankState widened to the timer width (see update())
+    using StateLane = uint64_t;
+
+    explicit LPDDR5BankArray(size_t count = 0) { resize(count); }
+
+    [[nodiscard]] size_t size() const { return state.size(); }
+
+    /// Resize to `count` banks, all precharged
+    void resize(size_t count) {
+        state.assign(count, lane(BankState::IDLE));
+        open_row.assign(count, 0);
+        state_until.assign(count, 0);
+        next_act.assign(count, 0);
+        next_rd.assign(count, 0);
+        next_wr.assign(count, 0);
+        next_pre.assign(count, 0);
+        precharge_until.assign(count, 0);
+        column_accesses.assign(count, 0);
+        row_conflict.assign(count, 0);
+        auto_precharge.assign(count, 0);
+        next_expiry_ = kNever;
+    }
+
+    /// Precharge every bank and clear all timing
+    void reset() { resize(size()); }
+
+    /// Put bank `i` in a transient state that ends at `until`
+    void enter(size_t i, BankState s, Cycle until) {
+        state[i] = lane(s);
+        state_until[i] = until;
+        next_expiry_ = std::min(next_expiry_, until);
+    }
+
+    [[nodiscard]] BankState state_of(size_t i) const { return static_cast<BankState>(state[i]); }
+
+    /// Put bank `i` in a steady state (IDLE or ACTIVE)
+    void set_state(size_t i, BankState s) { state[i] = lane(s); }
+
+    [[nodiscard]] bool is_ready_for(size_t i, RequestType type, Cycle now) const {
+        if (state_of(i) != BankState::ACTIVE) return false;
+        return (type == RequestType::READ) ? (now >= next_rd[i]) : (now >= next_wr[i]);
+    }
+
+    /// Earliest cycle a transient state ends (kNever if none)
+    [[nodiscard]] Cycle next_expiry() const { return next_expiry_; }
+
+    /// Complete the transient states that have ended by `now`
+    ///
+    /// ACTIVATING becomes ACTIVE; PRECHARGING and REFRESHING become IDLE;
+    /// READING/WRITING become ACTIVE, or PRECHARGING until
+    /// precharge_until after RDA/WRA.
+    void update(Cycle now) {
+        if (now < next_expiry_) {
+            return;
+        }
+
+        const StateLane kIdle = lane(BankState::IDLE);
+        const StateLane kActivating = lane(BankState::ACTIVATING);
+        const StateLane kActive = lane(BankState::ACTIVE);
+        const StateLane kReading = lane(BankState::READING);
+        const StateLane kWriting = lane(BankState::WRITING);
+        const StateLane kPrecharging = lane(BankState::PRECHARGING);
+        const StateLane kRefreshing = lane(BankState::REFRESHING);
+
+        StateLane* __restrict st = state.data();
+        Cycle* __restrict until = state_until.data();
+        uint64_t* __restrict ap = auto_precharge.data();
+        const Cycle* __restrict pre_until = precharge_until.data();
+        const size_t n = state.size();
+
+        // Conditions are all-ones/all-zero masks combined with & and |, so
+        // every lane takes the same path
+        Cycle expiry = kNever;
+        for (size_t i = 0; i < n; ++i) {
+            const StateLane s = st[i];
+            const Cycle u = until[i];
+            const uint64_t a = ap[i];
+
+            const uint64_t due = mask(now >= u);
+            const uint64_t column = mask((s == kReading) | (s == kWriting));
+            const uint64_t closing = column & mask(a != 0);
+
+            StateLane next = s;
+            next = (s == kActivating) ? kActive : next;
+            next = ((s == kPrecharging) | (s == kRefreshing)) ? kIdle : next;
+            next = column ? (closing ? kPrecharging : kActive) : next;
+            const StateLane after = (due & next) | (~due & s);
+            const uint64_t precharging = due & closing;
+            const Cycle after_until = (precharging & pre_until[i]) | (~precharging & u);
+
+            st[i] = after;
+            until[i] = after_until;
+            ap[i] = a & ~(due & column);
+
+            const uint64_t transient = mask((after != kIdle) & (after != kActive));
+            const Cycle bound = (transient & after_until) | (~transient & kNever);
+            expiry = bound < expiry ? bound : expiry;
+        }
+        next_expiry_ = expiry;
+    }
+
+    void save(CheckpointWriter& out) const {
+        out.write_vector(state);
+        out.write_vector(open_row);
+        out.write_vector(state_until);
+        out.write_vector(next_act);
+        out.write_vector(next_rd);
+        out.write_vector(next_wr);
+        out.write_vector(next_pre);
+        out.write_vector(precharge_until);
+        out.write_vector(column_accesses);
+        out.write_vector(row_conflict);
+        out.write_vector(auto_precharge);
+    }
+
+    void restore(CheckpointReader& in) {
+        in.read_vector_into(state);
+        in.read_vector_into(open_row);
+        in.read_vector_into(state_until);
+        in.read_vector_into(next_act);
+        in.read_vector_into(next_rd);
+        in.read_vector_into(next_wr);
+        in.read_vector_into(next_pre);
+        in.read_vector_into(precharge_until);
+        in.read_vector_into(column_accesses);
+        in.read_vector_into(row_conflict);
+        in.read_vector_into(auto_precharge);
+        for (StateLane s : state) {
+            if (s > lane(BankState::REFRESHING)) {
+                throw CheckpointError("checkpoint bank state is corrupt");
+            }
+        }
+        next_expiry_ = 0;    // Recomputed by the next update()
+    }
+
+    AlignedVector<StateLane> state;         ///< BankState per bank (see state_of())
+    AlignedVector<Row> open_row;
+    AlignedVector<Cycle> state_until;      ///< Cycle when current state completes
+
+    // Timing constraints
+    AlignedVector<Cycle> next_act;         ///< Earliest cycle for ACT
+    AlignedVector<Cycle> next_rd;          ///< Earliest cycle for RD
+    AlignedVector<Cycle> next_wr;          ///< Earliest cycle for WR
+    AlignedVector<Cycle> next_pre;         ///< Earliest cycle for PRE
+
+    // Row buffer bookkeeping
+    AlignedVector<Cycle> precharge_until;  ///< Completion of pending auto-precharge
+    AlignedVector<uint32_t> column_accesses; ///< Column accesses since last ACT
+    AlignedVector<uint8_t> row_conflict;   ///< Row was closed for a conflicting request
+    AlignedVector<uint64_t> auto_precharge; ///< RDA/WRA issued, precharge follows burst
+
+private:
+    static constexpr StateLane lane(BankState s) { return static_cast<StateLane>(s); }
+
+    /// All ones if `condition`, else zero
+    static constexpr uint64_t mask(bool condition) { return uint64_t{0} - condition; }
+
+    Cycle next_expiry_ = kNever;
+};
+
+} // namespace sw::memsim::lpddr5
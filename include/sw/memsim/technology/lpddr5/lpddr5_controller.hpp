@@ -3,11 +3,20 @@
 #include <sw/memsim/interface/memory_controller.hpp>
 #include <sw/memsim/interface/scheduler.hpp>
 #include <sw/memsim/interface/refresh_manager.hpp>
+#include <sw/memsim/scheduler/fifo.hpp>
 #include <sw/memsim/scheduler/fr_fcfs.hpp>
+#include <sw/memsim/scheduler/fr_fcfs_grp.hpp>
+#include <sw/memsim/technology/lpddr5/bank_array.hpp>
+#include <sw/memsim/core/pool.hpp>
+#include <sw/memsim/controller/write_buffer.hpp>
 
 #include <array>
+#include <deque>
 #include <queue>
 #include <random>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
 
 namespace sw::memsim::lpddr5 {
 
@@ -23,24 +32,29 @@ struct LPDDR5Timing : public TimingParams {
     static LPDDR5Timing from_speed(uint32_t speed_mt_s);
 };
 
-/// LPDDR5 bank state machine
-struct LPDDR5Bank {
-    BankState state = BankState::IDLE;
-    Row open_row = 0;
-    Cycle state_until = 0;     ///< Cycle when current state completes
-
-    // Timing constraints
-    Cycle next_act = 0;        ///< Earliest cycle for ACT
-    Cycle next_rd = 0;         ///< Earliest cycle for RD
-    Cycle next_wr = 0;         ///< Earliest cycle for WR
-    Cycle next_pre = 0;        ///< Earliest cycle for PRE
-
-    bool is_ready_for(RequestType type, Cycle now) const {
-        if (state != BankState::ACTIVE) return false;
+/// Command and data bus shared by the banks of one LPDDR5 channel
+struct LPDDR5Channel {
+    Cycle next_command = 0;    ///< Earliest cycle for any command (one per cycle)
+    Cycle next_rd = 0;         ///< Earliest RD (data bus burst, write-to-read turnaround)
+    Cycle next_wr = 0;         ///< Earliest WR (data bus burst, read-to-write turnaround)
+    Cycle next_rank_switch = 0; ///< Earliest column to another rank (tRTRS after the burst)
+    uint32_t next_bank = 0;    ///< Bank offset the round-robin starts from
+    uint32_t rank_batch = 0;   ///< Column accesses to last_rank in a row
+    RequestType last_column = RequestType::READ;
+    Rank last_rank = 0;
+
+    bool is_ready_for(RequestType type, Rank rank, Cycle now) const {
+        if (rank != last_rank && now < next_rank_switch) return false;
         return (type == RequestType::READ) ? (now >= next_rd) : (now >= next_wr);
     }
 };
 
+/// Refresh state of one LPDDR5 rank
+struct LPDDR5Rank {
+    Cycle next_refresh = 0;    ///< Cycle the next REF is due
+    bool refresh_due = false;  ///< Closing banks for REF; no new accesses
+};
+
 // ============================================================================
 // Behavioral LPDDR5 Controller
 // ============================================================================
@@ -87,11 +101,13 @@ public:
     [[nodiscard]] Technology technology() const override { return Technology::LPDDR5; }
     [[nodiscard]] const ControllerConfig& config() const override { return config_; }
 
-    [[nodiscard]] BankState bank_state(Channel, Bank) const override { return BankState::ACTIVE; }
-    [[nodiscard]] bool is_row_open(Channel, Bank, Row) const override { return true; }
-    [[nodiscard]] std::optional<Row> open_row(Channel, Bank) const override { return 0; }
+    [[nodiscard]] BankState bank_state(Channel, uint32_t) const override { return BankState::ACTIVE; }
+    [[nodiscard]] bool is_row_open(Channel, uint32_t, Row) const override { return true; }
+    [[nodiscard]] std::optional<Row> open_row(Channel, uint32_t) const override { return 0; }
     [[nodiscard]] Channel num_channels() const override { return config_.organization.num_channels; }
-    [[nodiscard]] Bank banks_per_channel() const override { return config_.organization.banks_per_rank(); }
+    [[nodiscard]] uint32_t banks_per_channel() const override {
+        return config_.organization.banks_per_channel();
+    }
 
     [[nodiscard]] const Statistics& stats() const override { return stats_; }
     [[nodiscard]] Statistics& stats() override { return stats_; }
@@ -106,6 +122,22 @@ public:
     [[nodiscard]] bool has_violations() const override { return false; }
     void clear_violations() override {}
 
+    [[nodiscard]] std::unique_ptr<IMemoryController> clone() const override {
+        return std::make_unique<BehavioralLPDDR5Controller>(*this);
+    }
+
+    void save_state(CheckpointWriter& out) const override {
+        out.write(current_cycle_);
+        out.write(next_id_);
+        out.write(stats_);
+    }
+
+    void restore_state(CheckpointReader& in) override {
+        current_cycle_ = in.read<Cycle>();
+        next_id_ = in.read<RequestId>();
+        stats_ = in.read<Statistics>();
+    }
+
 private:
     ControllerConfig config_;
     Cycle current_cycle_ = 0;
@@ -192,11 +224,13 @@ public:
     [[nodiscard]] Technology technology() const override { return Technology::LPDDR5; }
     [[nodiscard]] const ControllerConfig& config() const override { return config_; }
 
-    [[nodiscard]] BankState bank_state(Channel, Bank) const override { return BankState::ACTIVE; }
-    [[nodiscard]] bool is_row_open(Channel, Bank, Row) const override { return true; }
-    [[nodiscard]] std::optional<Row> open_row(Channel, Bank) const override { return std::nullopt; }
+    [[nodiscard]] BankState bank_state(Channel, uint32_t) const override { return BankState::ACTIVE; }
+    [[nodiscard]] bool is_row_open(Channel, uint32_t, Row) const override { return true; }
+    [[nodiscard]] std::optional<Row> open_row(Channel, uint32_t) const override { return std::nullopt; }
     [[nodiscard]] Channel num_channels() const override { return config_.organization.num_channels; }
-    [[nodiscard]] Bank banks_per_channel() const override { return config_.organization.banks_per_rank(); }
+    [[nodiscard]] uint32_t banks_per_channel() const override {
+        return config_.organization.banks_per_channel();
+    }
 
     [[nodiscard]] const Statistics& stats() const override { return stats_; }
     [[nodiscard]] Statistics& stats() override { return stats_; }
@@ -211,6 +245,52 @@ public:
     [[nodiscard]] bool has_violations() const override { return false; }
     void clear_violations() override {}
 
+    [[nodiscard]] std::unique_ptr<IMemoryController> clone() const override {
+        return std::make_unique<TransactionalLPDDR5Controller>(*this);
+    }
+
+    void save_state(CheckpointWriter& out) const override {
+        out.write(current_cycle_);
+        out.write(next_id_);
+
+        std::queue<PendingRequest> pending = pending_;
+        out.write<uint64_t>(pending.size());
+        while (!pending.empty()) {
+            out.write_request(pending.front().request);
+            out.write(pending.front().complete_cycle);
+            pending.pop();
+        }
+
+        // Engine and distribution state round-trip through their stream form
+        std::ostringstream rng;
+        rng << rng_ << ' ' << latency_dist_;
+        out.write_string(rng.str());
+        out.write(stats_);
+    }
+
+    void restore_state(CheckpointReader& in) override {
+        current_cycle_ = in.read<Cycle>();
+        next_id_ = in.read<RequestId>();
+
+        pending_ = {};
+        auto count = in.read<uint64_t>();
+        if (count > config_.queue_depth) {
+            throw CheckpointError("checkpoint queue exceeds queue depth");
+        }
+        for (uint64_t i = 0; i < count; ++i) {
+            Request request = in.read_request();
+            Cycle complete_cycle = in.read<Cycle>();
+            pending_.push({std::move(request), complete_cycle});
+        }
+
+        std::istringstream rng(in.read_string());
+        rng >> rng_ >> latency_dist_;
+        if (!rng) {
+            throw CheckpointError("checkpoint RNG state is corrupt");
+        }
+        stats_ = in.read<Statistics>();
+    }
+
 private:
     struct PendingRequest {
         Request request;
@@ -227,6 +307,11 @@ private:
             ? config_.timing.mean_read_latency
             : config_.timing.mean_write_latency;
 
+        // Multi-burst transfers occupy the data bus for each extra burst
+        uint32_t burst = config_.organization.burst_bytes();
+        uint32_t bursts = req.size > burst ? (req.size + burst - 1) / burst : 1;
+        base += static_cast<double>(bursts - 1) * config_.timing.tBurst;
+
         // Add variance
         double latency = base + latency_dist_(rng_);
         return static_cast<Cycle>(std::max(1.0, latency));
@@ -253,9 +338,26 @@ private:
 /// This controller implements:
 /// - Full LPDDR5 timing constraints
 /// - Per-bank state machines
-/// - FR-FCFS scheduling (configurable)
-/// - Per-bank refresh
+/// - Per-channel command and data buses (channels run in parallel)
+/// - Multiple ranks per channel with rank-to-rank switching on the data
+///   bus and same-rank batching of column accesses
+/// - FIFO, FR-FCFS or FR-FCFS with R/W grouping, bound statically
+/// - Open, closed and adaptive page policies (RDA/WRA auto-precharge)
+/// - Posted write buffer with coalescing and read forwarding (optional)
+/// - Splitting of multi-burst requests into pooled child accesses
+/// - Per-rank all-bank refresh (optional)
 /// - Power-down (optional)
+///
+/// The tick loop queries the scheduler per bank per cycle. Holding the
+/// concrete (final) Scheduler type lets those calls, including the row-hit
+/// search, inline into the bank loop instead of going through IScheduler's
+/// vtable. The controller is instantiated for FifoScheduler,
+/// FrFcfsScheduler and FrFcfsGrpScheduler; create_lpddr5_controller()
+/// picks one from ControllerConfig::scheduler, and the constructor rejects
+/// a config whose scheduler names another policy. Other IScheduler
+/// implementations must be final, provide copy() and be instantiated in
+/// lpddr5_controller.cpp.
+template <typename Scheduler = FrFcfsScheduler>
 class CycleAccurateLPDDR5Controller : public IMemoryController {
 public:
     explicit CycleAccurateLPDDR5Controller(const ControllerConfig& config);
@@ -277,11 +379,13 @@ public:
     [[nodiscard]] Technology technology() const override { return Technology::LPDDR5; }
     [[nodiscard]] const ControllerConfig& config() const override { return config_; }
 
-    [[nodiscard]] BankState bank_state(Channel channel, Bank bank) const override;
-    [[nodiscard]] bool is_row_open(Channel channel, Bank bank, Row row) const override;
-    [[nodiscard]] std::optional<Row> open_row(Channel channel, Bank bank) const override;
+    [[nodiscard]] BankState bank_state(Channel channel, uint32_t bank) const override;
+    [[nodiscard]] bool is_row_open(Channel channel, uint32_t bank, Row row) const override;
+    [[nodiscard]] std::optional<Row> open_row(Channel channel, uint32_t bank) const override;
     [[nodiscard]] Channel num_channels() const override { return config_.organization.num_channels; }
-    [[nodiscard]] Bank banks_per_channel() const override { return config_.organization.banks_per_rank(); }
+    [[nodiscard]] uint32_t banks_per_channel() const override {
+        return config_.organization.banks_per_channel();
+    }
 
     [[nodiscard]] const Statistics& stats() const override { return stats_; }
     [[nodiscard]] Statistics& stats() override { return stats_; }
@@ -296,24 +400,113 @@ public:
     [[nodiscard]] bool has_violations() const override { return !violations_.empty(); }
     void clear_violations() override { violations_.clear(); }
 
+    [[nodiscard]] std::unique_ptr<IMemoryController> clone() const override;
+    void save_state(CheckpointWriter& out) const override;
+    void restore_state(CheckpointReader& in) override;
+
+    /// Change the page policy mid-run (e.g. on a cloned branch)
+    void set_page_policy(PagePolicy policy) { config_.page_policy = policy; }
+
+    /// Channel/rank/bank/row/column a physical address maps to
+    [[nodiscard]] Request decode(Address address) const {
+        Request request;
+        request.address = address;
+        decode_address(request);
+        return request;
+    }
+
+    /// Functional warming: update the row buffer state a request would
+    /// leave behind, without timing, scheduling or statistics
+    ///
+    /// Used by the sampling controller between detailed windows. Only
+    /// valid while the controller has nothing pending.
+    void warm(Request request);
+
 private:
-    void decode_address(Request& request);
+    /// Outcome of admitting a single-burst access
+    enum class Admission : uint8_t {
+        QUEUED,     ///< Stored in the scheduler, DRAM access pending
+        COMPLETED,  ///< Posted to the write buffer or forwarded from it
+        REJECTED    ///< No buffer space
+    };
+
+    /// A request larger than one burst, issued as child column accesses
+    struct SplitRequest {
+        Request parent;            ///< Original request (id, callback, timing)
+        Address next = 0;          ///< Next burst address to issue
+        Address end = 0;           ///< One past the last byte
+        uint32_t outstanding = 0;  ///< Children queued but not yet complete
+        bool dram_access = false;  ///< At least one child went to DRAM
+    };
+
+    /// Ranks whose row hits may take the data bus in a scan
+    enum class RankFilter : uint8_t {
+        SAME,       ///< Only the rank of the last column access
+        OTHER,      ///< Only the other ranks
+        ANY
+    };
+
+    /// What one bank scan saw besides the command it issued
+    struct ScanResult {
+        bool rank_hit = false;            ///< A row hit of the preferred rank waits
+        BankIndex fallback = 0;           ///< Ready row hit filtered out, if any
+        Request* fallback_request = nullptr;
+    };
+
+    static constexpr uint32_t kNoParent = ~uint32_t{0};
+
+    static void save_split(CheckpointWriter& out, const SplitRequest& split);
+    static SplitRequest load_split(CheckpointReader& in);
+
+    [[nodiscard]] Address burst_base(Address address) const {
+        return address & ~(static_cast<Address>(burst_bytes_) - 1);
+    }
+
+    Admission admit(Request& request, uint32_t parent);
+    std::optional<RequestId> submit_split(Request request);
+    void feed_split_requests();
+    void complete_child(uint32_t parent);
+    void complete_split(uint32_t parent);
+
+    void decode_address(Request& request) const;
+    /// Flat index of a channel's bank, or banks_.size() if out of range
+    [[nodiscard]] size_t channel_bank(Channel channel, uint32_t bank) const;
     void update_bank_states();
     void issue_commands();
+    bool scan_banks(LPDDR5Channel& channel, size_t channel_idx, RankFilter filter);
+    bool issue_command(LPDDR5Channel& channel, BankIndex bank_idx, RankFilter filter, ScanResult& scan);
+    void issue_row_hit(LPDDR5Channel& channel, BankIndex bank_idx, Request& request);
+    bool refresh_ranks(size_t channel_idx);
+    void reset_refresh();
     void complete_transfers();
     void check_timing_invariants();
 
+    void drain_write_buffer();
+
+    void activate(BankIndex bank, Row row);
+    void precharge(BankIndex bank);
+    void issue_column(BankIndex bank, LPDDR5Channel& channel, Request& request, Command command);
+    [[nodiscard]] bool should_auto_precharge(BankIndex bank, const Request& request) const;
+
     ControllerConfig config_;
     Cycle current_cycle_ = 0;
     RequestId next_id_ = 1;
 
-    std::vector<LPDDR5Bank> banks_;
-    std::unique_ptr<IScheduler> scheduler_;
+    LPDDR5BankArray banks_;                ///< Indexed by Request::bank_index
+    std::vector<LPDDR5Channel> channels_;
+    std::vector<LPDDR5Rank> ranks_;        ///< Indexed by bank_index / banks_per_rank
+    Pool<Request> requests_;
+    std::vector<uint32_t> parent_of_;      ///< Split parent per request slot
+    size_t queued_children_ = 0;           ///< Request slots held by split children
+    Pool<SplitRequest> splits_;
+    std::deque<uint32_t> splitting_;       ///< Splits with children left to issue
+    uint32_t burst_bytes_;
+    SchedulerConfig sched_config_;
+    std::unique_ptr<Scheduler> scheduler_;
     std::unique_ptr<IRefreshManager> refresh_;
 
-    RequestType last_command_ = RequestType::READ;
-    Cycle last_read_cycle_ = 0;
-    Cycle last_write_cycle_ = 0;
+    WriteBuffer write_buffer_;
+    bool draining_writes_ = false;
 
     Statistics stats_;
     bool tracing_ = false;
@@ -321,10 +514,42 @@ private:
     std::vector<Violation> violations_;
 };
 
+extern template class CycleAccurateLPDDR5Controller<FifoScheduler>;
+extern template class CycleAccurateLPDDR5Controller<FrFcfsScheduler>;
+extern template class CycleAccurateLPDDR5Controller<FrFcfsGrpScheduler>;
+
 // ============================================================================
 // Factory
 // ============================================================================
 
+/// Construct `Controller<Scheduler>` for the scheduler named by config.scheduler
+///
+/// The policy is resolved here, once, to a controller instantiation; the
+/// tick loop never dispatches on it. `args` follow the config in the
+/// controller's constructor.
+template <template <typename> class Controller, typename... Args>
+std::unique_ptr<IMemoryController> make_with_scheduler(const ControllerConfig& config,
+                                                       Args&&... args)
+{
+    switch (config.scheduler) {
+        case SchedulerPolicy::FIFO:
+            return std::make_unique<Controller<FifoScheduler>>(config, std::forward<Args>(args)...);
+        case SchedulerPolicy::FR_FCFS:
+            return std::make_unique<Controller<FrFcfsScheduler>>(config, std::forward<Args>(args)...);
+        case SchedulerPolicy::FR_FCFS_GRP:
+            return std::make_unique<Controller<FrFcfsGrpScheduler>>(config, std::forward<Args>(args)...);
+        default:
+            throw std::invalid_argument("scheduler policy is not implemented");
+    }
+}
+
+/// Create a cycle-accurate LPDDR5 controller for config.scheduler
+inline std::unique_ptr<IMemoryController> create_cycle_accurate_lpddr5_controller(
+    const ControllerConfig& config)
+{
+    return make_with_scheduler<CycleAccurateLPDDR5Controller>(config);
+}
+
 /// Create LPDDR5 controller based on fidelity level
 inline std::unique_ptr<IMemoryController> create_lpddr5_controller(
     const ControllerConfig& config)
@@ -335,7 +560,7 @@ inline std::unique_ptr<IMemoryController> create_lpddr5_controller(
         case Fidelity::TRANSACTIONAL:
             return std::make_unique<TransactionalLPDDR5Controller>(config);
         case Fidelity::CYCLE_ACCURATE:
-            return std::make_unique<CycleAccurateLPDDR5Controller>(config);
+            return create_cycle_accurate_lpddr5_controller(config);
         default:
             return nullptr;
     }
@@ -0,0 +1,336 @@
+#pragma once
+
+#include <sw/memsim/technology/lpddr5/lpddr5_controller.hpp>
+
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace sw::memsim::lpddr5 {
+
+/// Sampling schedule (in requests)
+///
+/// Every `period` requests form one sampling unit: the first
+/// period - warmup - measure requests are functionally warmed, the next
+/// `warmup` run cycle-accurate to settle queues, and the last `measure`
+/// run cycle-accurate and are measured.
+struct SamplingConfig {
+    uint64_t period = 100000;     ///< Requests per sampling unit
+    uint64_t warmup = 2000;       ///< Detailed requests before measuring
+    uint64_t measure = 1000;      ///< Detailed requests measured per unit
+};
+
+/// Metric estimated from sampling units
+struct SampledMetric {
+    uint64_t samples = 0;
+    double mean = 0.0;
+    double stddev = 0.0;          ///< Sample standard deviation across units
+    double ci95 = 0.0;            ///< Half-width of the 95% confidence interval
+
+    /// Confidence half-width relative to the mean
+    double relative_error() const {
+        return mean != 0.0 ? ci95 / std::abs(mean) : 0.0;
+    }
+
+    /// Summarize per-unit observations (Student-t interval)
+    static SampledMetric from(const std::vector<double>& values) {
+        SampledMetric m;
+        m.samples = values.size();
+        if (values.empty()) {
+            return m;
+        }
+        double sum = 0.0;
+        for (double v : values) {
+            sum += v;
+        }
+        m.mean = sum / static_cast<double>(values.size());
+        if (values.size() < 2) {
+            return m;
+        }
+        double sq = 0.0;
+        for (double v : values) {
+            sq += (v - m.mean) * (v - m.mean);
+        }
+        m.stddev = std::sqrt(sq / static_cast<double>(values.size() - 1));
+        m.ci95 = t_quantile(values.size() - 1) * m.stddev /
+                 std::sqrt(static_cast<double>(values.size()));
+        return m;
+    }
+
+private:
+    /// Two-sided 95% Student-t quantile
+    static double t_quantile(uint64_t dof) {
+        static constexpr double table[] = {
+            12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+            2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+            2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+        };
+        return dof <= 30 ? table[dof - 1] : 1.960;
+    }
+};
+
+/// Estimates reported by the sampling controller
+struct SamplingReport {
+    SampledMetric avg_latency;        ///< Cycles per request
+    SampledMetric page_hit_rate;
+    SampledMetric bytes_per_cycle;    ///< Delivered bandwidth
+    uint64_t functional_requests = 0;
+    uint64_t detailed_requests = 0;
+};
+
+// ============================================================================
+// Sampling LPDDR5 Controller
+// ============================================================================
+
+/// SMARTS-style sampling controller
+///
+/// Alternates between two LPDDR5 models over one request stream:
+/// - Functional warming: requests complete through the behavioral model
+///   (fixed latency) while the cycle-accurate model's open-row tables are
+///   updated without timing
+/// - Detailed windows: requests run through the cycle-accurate model;
+///   the last `measure` requests of each window are measured
+///
+/// Each window is drained before returning to functional mode, and its
+/// average latency, page hit rate and bandwidth become one sample of the
+/// report. Latencies seen by callbacks are behavioral in functional phases
+/// and cycle-accurate in detailed ones; stats() aggregates both. Detailed
+/// windows schedule with `Scheduler`, which config.scheduler must name;
+/// create_sampling_lpddr5_controller() picks it from the config.
+template <typename Scheduler = FrFcfsScheduler>
+class SamplingLPDDR5Controller : public IMemoryController {
+public:
+    SamplingLPDDR5Controller(const ControllerConfig& config, const SamplingConfig& sampling)
+        : config_(config)
+        , sampling_(sampling)
+        , functional_(config)
+        , detailed_(config)
+    {
+        if (config.scheduler != Scheduler::kPolicy) {
+            throw std::invalid_argument("config.scheduler does not match the controller's scheduler");
+        }
+        if (sampling.period == 0 || sampling.measure == 0 ||
+            sampling.warmup + sampling.measure > sampling.period) {
+            throw std::invalid_argument("sampling windows must fit inside the sampling period");
+        }
+    }
+
+    std::optional<RequestId> submit(Request request) override {
+        uint64_t pos = submitted_ % sampling_.period;
+        uint64_t functional_len = sampling_.period - sampling_.warmup - sampling_.measure;
+
+        if (pos < functional_len) {
+            if (in_window_) {
+                finish_window();
+            }
+            detailed_.warm(request);
+            auto id = functional_.submit(std::move(request));
+            submitted_++;
+            report_.functional_requests++;
+            return id;
+        }
+
+        if (!in_window_) {
+            start_window();
+        }
+        bool measured = pos >= functional_len + sampling_.warmup;
+        if (measured && !measuring_) {
+            begin_measurement();
+        }
+
+        uint32_t size = request.size;
+        RequestType type = request.type;
+        request.callback = [this, type, callback = std::move(request.callback)](Cycle latency) {
+            detailed_stats_.record_completion(type, latency);
+            if (callback) {
+                callback(latency);
+            }
+        };
+        auto id = detailed_.submit(std::move(request));
+        if (id) {
+            submitted_++;
+            report_.detailed_requests++;
+            if (measured) {
+                window_bytes_ += size;
+            }
+        }
+        return id;
+    }
+
+    [[nodiscard]] bool can_accept() const override {
+        return !in_window_ || detailed_.can_accept();
+    }
+
+    [[nodiscard]] bool has_pending() const override { return detailed_.has_pending(); }
+    [[nodiscard]] size_t pending_count() const override { return detailed_.pending_count(); }
+
+    void tick() override {
+        if (in_window_) {
+            detailed_.tick();
+        } else {
+            functional_.tick();
+        }
+    }
+
+    void drain() override {
+        detailed_.drain();
+        if (in_window_) {
+            finish_window();
+        }
+    }
+
+    void reset() override {
+        functional_.reset();
+        detailed_.reset();
+        submitted_ = 0;
+        in_window_ = false;
+        measuring_ = false;
+        window_bytes_ = 0;
+        latency_samples_.clear();
+        hit_rate_samples_.clear();
+        bandwidth_samples_.clear();
+        report_ = SamplingReport{};
+        detailed_stats_.reset();
+        stats_.reset();
+    }
+
+    [[nodiscard]] Cycle cycle() const override {
+        return in_window_ ? detailed_.cycle() : functional_.cycle();
+    }
+
+    void set_cycle(Cycle c) override {
+        functional_.set_cycle(c);
+        detailed_.set_cycle(c);
+    }
+
+    [[nodiscard]] Fidelity fidelity() const override { return Fidelity::CYCLE_ACCURATE; }
+    [[nodiscard]] Technology technology() const override { return Technology::LPDDR5; }
+    [[nodiscard]] const ControllerConfig& config() const override { return config_; }
+
+    [[nodiscard]] BankState bank_state(Channel c, uint32_t b) const override { return detailed_.bank_state(c, b); }
+    [[nodiscard]] bool is_row_open(Channel c, uint32_t b, Row r) const override { return detailed_.is_row_open(c, b, r); }
+    [[nodiscard]] std::optional<Row> open_row(Channel c, uint32_t b) const override { return detailed_.open_row(c, b); }
+    [[nodiscard]] Channel num_channels() const override { return config_.organization.num_channels; }
+    [[nodiscard]] uint32_t banks_per_channel() const override {
+        return config_.organization.banks_per_channel();
+    }
+
+    /// Requests completed so far, functional and detailed
+    [[nodiscard]] const Statistics& stats() const override {
+        stats_ = functional_.stats();
+        stats_.merge(detailed_stats_);
+        return stats_;
+    }
+
+    [[nodiscard]] Statistics& stats() override {
+        std::as_const(*this).stats();
+        return stats_;
+    }
+
+    void reset_stats() override {
+        functional_.reset_stats();
+        detailed_.reset_stats();
+        detailed_stats_.reset();
+    }
+
+    void enable_tracing(bool e) override { detailed_.enable_tracing(e); }
+    [[nodiscard]] bool tracing_enabled() const override { return detailed_.tracing_enabled(); }
+    void enable_invariants(bool e) override { detailed_.enable_invariants(e); }
+    [[nodiscard]] bool invariants_enabled() const override { return detailed_.invariants_enabled(); }
+
+    [[nodiscard]] const std::vector<Violation>& violations() const override { return detailed_.violations(); }
+    [[nodiscard]] bool has_violations() const override { return detailed_.has_violations(); }
+    void clear_violations() override { detailed_.clear_violations(); }
+
+    // ========================================================================
+    // Sampling Interface
+    // ========================================================================
+
+    [[nodiscard]] const SamplingConfig& sampling_config() const { return sampling_; }
+
+    /// Estimates with 95% confidence intervals over completed windows
+    [[nodiscard]] SamplingReport report() const {
+        SamplingReport r = report_;
+        r.avg_latency = SampledMetric::from(latency_samples_);
+        r.page_hit_rate = SampledMetric::from(hit_rate_samples_);
+        r.bytes_per_cycle = SampledMetric::from(bandwidth_samples_);
+        return r;
+    }
+
+private:
+    void start_window() {
+        // Detailed time resumes where functional time left off
+        detailed_.set_cycle(std::max(detailed_.cycle(), functional_.cycle()));
+        in_window_ = true;
+    }
+
+    void begin_measurement() {
+        window_start_ = detailed_.stats();
+        window_completions_ = detailed_stats_;
+        window_cycle_ = detailed_.cycle();
+        window_bytes_ = 0;
+        measuring_ = true;
+    }
+
+    void finish_window() {
+        detailed_.drain();
+        in_window_ = false;
+        functional_.set_cycle(std::max(functional_.cycle(), detailed_.cycle()));
+        if (!measuring_) {
+            return;
+        }
+        measuring_ = false;
+
+        const Statistics& now = detailed_.stats();
+        uint64_t requests = detailed_stats_.total_requests() - window_completions_.total_requests();
+        uint64_t latency = (detailed_stats_.total_read_latency + detailed_stats_.total_write_latency) -
+                           (window_completions_.total_read_latency + window_completions_.total_write_latency);
+        uint64_t hits = now.page_hits - window_start_.page_hits;
+        uint64_t accesses = (now.page_hits + now.page_empty + now.page_conflicts) -
+                            (window_start_.page_hits + window_start_.page_empty + window_start_.page_conflicts);
+        Cycle cycles = detailed_.cycle() - window_cycle_;
+
+        if (requests > 0) {
+            latency_samples_.push_back(static_cast<double>(latency) / static_cast<double>(requests));
+        }
+        if (accesses > 0) {
+            hit_rate_samples_.push_back(static_cast<double>(hits) / static_cast<double>(accesses));
+        }
+        if (cycles > 0) {
+            bandwidth_samples_.push_back(static_cast<double>(window_bytes_) / static_cast<double>(cycles));
+        }
+    }
+
+    ControllerConfig config_;
+    SamplingConfig sampling_;
+    BehavioralLPDDR5Controller functional_;
+    CycleAccurateLPDDR5Controller<Scheduler> detailed_;
+
+    uint64_t submitted_ = 0;
+    bool in_window_ = false;
+    bool measuring_ = false;
+
+    // Measurement window
+    Statistics window_start_;          ///< DRAM-side counters at measure start
+    Statistics window_completions_;    ///< Completions at measure start
+    Cycle window_cycle_ = 0;
+    uint64_t window_bytes_ = 0;
+
+    std::vector<double> latency_samples_;
+    std::vector<double> hit_rate_samples_;
+    std::vector<double> bandwidth_samples_;
+    SamplingReport report_;
+
+    Statistics detailed_stats_;        ///< Completions of detailed requests
+    mutable Statistics stats_;
+};
+
+/// Create a sampling LPDDR5 controller for config.scheduler
+inline std::unique_ptr<IMemoryController> create_sampling_lpddr5_controller(
+    const ControllerConfig& config, const SamplingConfig& sampling)
+{
+    return make_with_scheduler<SamplingLPDDR5Controller>(config, sampling);
+}
+
+} // namespace sw::memsim::lpddr5
@@ -0,0 +1,409 @@
+#pragma once
+
+#include <sw/memsim/controller/controller_component.hpp>
+#include <sw/memsim/core/event_kernel.hpp>
+#include <sw/memsim/core/types.hpp>
+#include <sw/memsim/interface/memory_controller.hpp>
+
+#include <algorithm>
+#include <array>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace sw::memsim::workload {
+
+// ============================================================================
+// Coroutine Frame Pool
+// ============================================================================
+
+/// Size-class free lists for agent coroutine frames
+///
+/// Agents are created and retired in large numbers (one per DMA transfer
+/// or per tile is common), so frames are recycled instead of going back to
+/// the heap. Frames up to kMaxPooled bytes are rounded to 64-byte classes;
+/// larger ones use the global allocator. Pools are per thread, matching the
+/// single-threaded simulation loop.
+class FramePool {
+public:
+    static constexpr size_t kGranule = 64;
+    static constexpr size_t kMaxPooled = 4096;
+
+    static void* allocate(size_t bytes) {
+        size_t cls = size_class(bytes);
+        if (cls >= kClasses) {
+            return ::operator new(bytes);
+        }
+        Lists& lists = local();
+        lists.allocations++;
+        if (Node* node = lists.head[cls]) {
+            lists.head[cls] = node->next;
+            lists.reuses++;
+            return node;
+        }
+        return ::operator new((cls + 1) * kGranule);
+    }
+
+    static void deallocate(void* frame, size_t bytes) {
+        size_t cls = size_class(bytes);
+        if (cls >= kClasses) {
+            ::operator delete(frame);
+            return;
+        }
+        Lists& lists = local();
+        Node* node = static_cast<Node*>(frame);
+        node->next = lists.head[cls];
+        lists.head[cls] = node;
+    }
+
+    /// Pooled allocations on this thread
+    static uint64_t allocations() { return local().allocations; }
+
+    /// Pooled allocations served from a free list
+    static uint64_t reuses() { return local().reuses; }
+
+private:
+    static constexpr size_t kClasses = kMaxPooled / kGranule;
+
+    struct Node {
+        Node* next;
+    };
+
+    struct Lists {
+        std::array<Node*, kClasses> head{};
+        uint64_t allocations = 0;
+        uint64_t reuses = 0;
+
+        ~Lists() {
+            for (Node* node : head) {
+                while (node) {
+                    Node* next = node->next;
+                    ::operator delete(node);
+                    node = next;
+                }
+            }
+        }
+    };
+
+    static size_t size_class(size_t bytes) { return (bytes + kGranule - 1) / kGranule - 1; }
+
+    static Lists& local() {
+        thread_local Lists lists;
+        return lists;
+    }
+};
+
+// ============================================================================
+// Agent Coroutine
+// ============================================================================
+
+/// Coroutine type of a traffic agent
+///
+/// An agent is any coroutine returning Agent; it awaits memory accesses
+/// and delays through an AgentScheduler:
+///
+/// ```cpp
+/// Agent dma(AgentScheduler& s, Address src, int lines) {
+///     for (int i = 0; i < lines; ++i) {
+///         Cycle latency = co_await s.read(src + i * 64, 64);
+///         co_await s.delay(4);
+///     }
+/// }
+/// scheduler.spawn(dma(scheduler, 0x1000, 16));
+/// ```
+///
+/// Agents start suspended and only run once spawned.
+class Agent {
+public:
+    struct promise_type {
+        std::exception_ptr error;
+
+        Agent get_return_object() {
+            return Agent(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { error = std::current_exception(); }
+
+        static void* operator new(size_t bytes) { return FramePool::allocate(bytes); }
+        static void operator delete(void* frame, size_t bytes) { FramePool::deallocate(frame, bytes); }
+    };
+
+    using Handle = std::coroutine_handle<promise_type>;
+
+    Agent(Agent&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+    Agent& operator=(Agent&& other) noexcept {
+        if (this != &other) {
+            if (handle_) {
+                handle_.destroy();
+            }
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+    Agent(const Agent&) = delete;
+    Agent& operator=(const Agent&) = delete;
+
+    ~Agent() {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    /// Give up ownership of the coroutine (to the scheduler)
+    Handle release() { return std::exchange(handle_, {}); }
+
+private:
+    explicit Agent(Handle handle) : handle_(handle) {}
+
+    Handle handle_;
+};
+
+// ============================================================================
+// Agent Scheduler
+// ============================================================================
+
+/// Runs agents against one memory controller on an event kernel
+///
+/// Agents are resumed by kernel events: when their delay expires, when
+/// their access completes, or when a back-pressured access is retried (the
+/// next cycle, in order). Completions never resume an agent from inside the
+/// controller's callback; the resumption is scheduled on the kernel, so
+/// agents may issue new accesses freely.
+///
+/// A completed access resumes its agent at issue cycle + reported latency,
+/// so fixed-latency (behavioral) controllers, which complete at submit,
+/// still advance simulated time. The controller is only ticked while it
+/// has work, so idle stretches cost nothing.
+///
+/// A standalone scheduler owns its kernel. Schedulers for several
+/// controllers can share one kernel (each with its ControllerComponent);
+/// the kernel then interleaves all of their agents and must not run after
+/// a scheduler is destroyed.
+class AgentScheduler {
+public:
+    /// Standalone scheduler with a private kernel
+    explicit AgentScheduler(IMemoryController& controller)
+        : owned_kernel_(std::make_unique<EventKernel>(1024, controller.cycle()))
+        , owned_port_(std::make_unique<ControllerComponent>(*owned_kernel_, controller))
+        , kernel_(*owned_kernel_)
+        , port_(*owned_port_)
+    {}
+
+    /// Scheduler on a shared kernel
+    AgentScheduler(EventKernel& kernel, ControllerComponent& port)
+        : kernel_(kernel)
+        , port_(port)
+    {}
+
+    AgentScheduler(const AgentScheduler&) = delete;
+    AgentScheduler& operator=(const AgentScheduler&) = delete;
+
+    /// Outstanding accesses complete (the controller is drained) before
+    /// unfinished agents are destroyed, so the controller must outlive the
+    /// scheduler
+    ~AgentScheduler() {
+        if (outstanding_ > 0) {
+            port_.controller().drain();
+        }
+        for (Agent::Handle handle : agents_) {
+            handle.destroy();
+        }
+    }
+
+    // ========================================================================
+    // Awaitables
+    // ========================================================================
+
+    /// Memory access; `co_await` yields the latency reported by the controller
+    class Access {
+    public:
+        Access(AgentScheduler& scheduler, Address address, uint32_t size, RequestType type)
+            : scheduler_(scheduler), address_(address), size_(size), type_(type)
+        {}
+
+        bool await_ready() const noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> handle) {
+            handle_ = handle;
+            if (!scheduler_.issue(*this)) {
+                scheduler_.blocked_.push_back(this);
+                scheduler_.schedule_retry();
+            }
+        }
+
+        Cycle await_resume() const noexcept { return latency_; }
+
+    private:
+        friend class AgentScheduler;
+
+        AgentScheduler& scheduler_;
+        Address address_;
+        uint32_t size_;
+        RequestType type_;
+        std::coroutine_handle<> handle_;
+        Cycle latency_ = 0;
+    };
+
+    /// Suspend the agent for a number of cycles (0 yields to other agents)
+    class Delay {
+    public:
+        Delay(AgentScheduler& scheduler, Cycle cycles) : scheduler_(scheduler), cycles_(cycles) {}
+
+        bool await_ready() const noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> handle) {
+            scheduler_.resume_at(scheduler_.cycle() + cycles_, handle);
+        }
+
+        void await_resume() const noexcept {}
+
+    private:
+        AgentScheduler& scheduler_;
+        Cycle cycles_;
+    };
+
+    [[nodiscard]] Access read(Address address, uint32_t size) {
+        return Access(*this, address, size, RequestType::READ);
+    }
+
+    [[nodiscard]] Access write(Address address, uint32_t size) {
+        return Access(*this, address, size, RequestType::WRITE);
+    }
+
+    [[nodiscard]] Delay delay(Cycle cycles) { return Delay(*this, cycles); }
+
+    // ========================================================================
+    // Simulation Loop
+    // ========================================================================
+
+    /// Hand an agent to the scheduler; it first runs at the current cycle
+    void spawn(Agent agent) {
+        Agent::Handle handle = agent.release();
+        agents_.push_back(handle);
+        resume_at(cycle(), handle);
+    }
+
+    /// Run the kernel until every agent of this scheduler has finished;
+    /// rethrows the first exception an agent ended with
+    void run() {
+        while (!agents_.empty()) {
+            if (!kernel_.step()) {
+                throw std::logic_error("agents are waiting for events that will never occur");
+            }
+            rethrow_agent_error();
+        }
+    }
+
+    /// Run until the kernel reaches `end` or every agent has finished
+    void run_until(Cycle end) {
+        while (!agents_.empty()) {
+            auto next = kernel_.next_event();
+            if (!next || *next > end) {
+                break;
+            }
+            kernel_.step();
+            rethrow_agent_error();
+        }
+        if (!agents_.empty()) {
+            kernel_.run_until(end);
+        }
+    }
+
+    /// Process the kernel's next busy cycle
+    void step() {
+        kernel_.step();
+        rethrow_agent_error();
+    }
+
+    [[nodiscard]] Cycle cycle() const { return kernel_.now(); }
+    [[nodiscard]] size_t active_agents() const { return agents_.size(); }
+    [[nodiscard]] uint64_t accesses_completed() const { return completed_; }
+    [[nodiscard]] IMemoryController& controller() { return port_.controller(); }
+    [[nodiscard]] EventKernel& kernel() { return kernel_; }
+
+private:
+    bool issue(Access& access) {
+        Request request;
+        request.address = access.address_;
+        request.size = access.size_;
+        request.type = access.type_;
+        const Cycle issued = cycle();
+        request.callback = [this, &access, issued](Cycle latency) {
+            access.latency_ = latency;
+            outstanding_--;
+            completed_++;
+            resume_at(issued + latency, access.handle_);
+        };
+        outstanding_++;
+        if (!port_.submit(std::move(request))) {
+            outstanding_--;
+            return false;
+        }
+        return true;
+    }
+
+    void resume_at(Cycle when, std::coroutine_handle<> handle) {
+        kernel_.schedule_at(std::max(when, cycle()), [this, handle] { resume(handle); });
+    }
+
+    void schedule_retry() {
+        if (retry_scheduled_) {
+            return;
+        }
+        retry_scheduled_ = true;
+        kernel_.schedule_in(1, [this] {
+            retry_scheduled_ = false;
+            while (!blocked_.empty() && issue(*blocked_.front())) {
+                blocked_.pop_front();
+            }
+            if (!blocked_.empty()) {
+                schedule_retry();
+            }
+        });
+    }
+
+    void resume(std::coroutine_handle<> handle) {
+        handle.resume();
+        if (handle.done()) {
+            retire(handle);
+        }
+    }
+
+    /// Destroy a finished agent, keeping the first exception for run()
+    void retire(std::coroutine_handle<> handle) {
+        auto agent = Agent::Handle::from_address(handle.address());
+        if (agent.promise().error && !error_) {
+            error_ = agent.promise().error;
+        }
+        std::erase(agents_, agent);
+        agent.destroy();
+    }
+
+    void rethrow_agent_error() {
+        if (error_) {
+            std::rethrow_exception(std::exchange(error_, nullptr));
+        }
+    }
+
+    std::unique_ptr<EventKernel> owned_kernel_;
+    std::unique_ptr<ControllerComponent> owned_port_;
+    EventKernel& kernel_;
+    ControllerComponent& port_;
+
+    std::vector<Agent::Handle> agents_;          ///< Live agents (owned)
+    std::deque<Access*> blocked_;                ///< Back-pressured accesses, in order
+    bool retry_scheduled_ = false;
+    uint64_t outstanding_ = 0;
+    uint64_t completed_ = 0;
+    std::exception_ptr error_;
+};
+
+} // namespace sw::memsim::workload
@@ -0,0 +1,573 @@
+#pragma once
+
+#include <sw/memsim/core/types.hpp>
+#include <sw/memsim/interface/memory_controller.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace sw::memsim::workload {
+
+// ============================================================================
+// Random Numbers
+// ============================================================================
+
+/// SplitMix64 generator
+///
+/// Used instead of the standard distributions so that a seed produces the
+/// same traffic with every standard library.
+class Rng {
+public:
+    explicit Rng(uint64_t seed = 1) : state_(seed) {}
+
+    uint64_t next() {
+        uint64_t z = (state_ += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    /// Uniform in [0, 1)
+    double uniform() {
+        return static_cast<double>(next() >> 11) * 0x1.0p-53;
+    }
+
+    /// Uniform in [0, bound)
+    uint64_t below(uint64_t bound) {
+        return bound > 0 ? next() % bound : 0;
+    }
+
+private:
+    uint64_t state_;
+};
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+/// Inter-arrival time distribution
+enum class ArrivalProcess : uint8_t {
+    BACK_TO_BACK,    ///< All requests available at cycle 0 (closed loop)
+    FIXED,           ///< Constant gap of mean_gap cycles
+    UNIFORM,         ///< Gap uniform in [0, 2 * mean_gap]
+    POISSON          ///< Exponential gaps with mean mean_gap
+};
+
+constexpr std::string_view to_string(ArrivalProcess process) {
+    switch (process) {
+        case ArrivalProcess::BACK_TO_BACK: return "BACK_TO_BACK";
+        case ArrivalProcess::FIXED: return "FIXED";
+        case ArrivalProcess::UNIFORM: return "UNIFORM";
+        case ArrivalProcess::POISSON: return "POISSON";
+    }
+    return "UNKNOWN";
+}
+
+struct ArrivalConfig {
+    ArrivalProcess process = ArrivalProcess::BACK_TO_BACK;
+    double mean_gap = 1.0;            ///< Mean cycles between requests
+};
+
+/// Parameters shared by all generators
+struct GeneratorConfig {
+    Address base = 0;                 ///< First byte of the accessed region
+    Address footprint = 1ULL << 26;   ///< Region size in bytes (addresses wrap)
+    uint32_t size = 64;               ///< Bytes per request
+    double read_ratio = 1.0;          ///< Fraction of reads
+    uint16_t source = 0;              ///< Request::source of emitted requests
+    ArrivalConfig arrival;
+    uint64_t seed = 1;
+};
+
+// ============================================================================
+// Generator Interface
+// ============================================================================
+
+/// One access of a pattern: byte offset within the footprint and length
+struct Access {
+    Address offset = 0;
+    uint32_t size = 0;
+};
+
+/// Synthetic request stream
+///
+/// Emitted requests carry address, size, type and source. Their
+/// `submit_cycle` holds the intended arrival cycle relative to the start of
+/// the stream; controllers overwrite it on submit, and drive() uses it to
+/// pace submission. Streams are infinite and reproducible: reset() restarts
+/// the sequence from the seed.
+class Generator {
+public:
+    explicit Generator(const GeneratorConfig& config)
+        : config_(config)
+        , rng_(config.seed)
+    {
+        if (config.size == 0 || config.footprint < config.size) {
+            throw std::invalid_argument("generator footprint must hold at least one request");
+        }
+        if (config.read_ratio < 0.0 || config.read_ratio > 1.0) {
+            throw std::invalid_argument("read_ratio must be within [0, 1]");
+        }
+        if (config.arrival.mean_gap < 0.0) {
+            throw std::invalid_argument("mean_gap must not be negative");
+        }
+    }
+
+    virtual ~Generator() = default;
+
+    /// Next request of the stream
+    virtual Request next() {
+        Access access = next_access();
+        Request request;
+        request.address = config_.base + access.offset;
+        request.size = access.size;
+        request.source = config_.source;
+        request.type = rng_.uniform() < config_.read_ratio ? RequestType::READ : RequestType::WRITE;
+        request.submit_cycle = next_arrival();
+        return request;
+    }
+
+    /// Emit requests directly into a caller-owned batch buffer
+    size_t fill(std::span<Request> batch) {
+        for (auto& request : batch) {
+            request = next();
+        }
+        return batch.size();
+    }
+
+    /// Restart the stream from its seed
+    virtual void reset() {
+        rng_ = Rng(config_.seed);
+        time_ = 0.0;
+        restart();
+    }
+
+    [[nodiscard]] const GeneratorConfig& config() const { return config_; }
+
+protected:
+    /// Next access of the pattern
+    virtual Access next_access() = 0;
+
+    /// Reset pattern state
+    virtual void restart() {}
+
+    /// Requests that fit in the footprint
+    [[nodiscard]] uint64_t slots() const { return config_.footprint / config_.size; }
+
+    Cycle next_arrival() {
+        Cycle arrival = static_cast<Cycle>(time_);
+        const double mean = config_.arrival.mean_gap;
+        switch (config_.arrival.process) {
+            case ArrivalProcess::BACK_TO_BACK:
+                break;
+            case ArrivalProcess::FIXED:
+                time_ += mean;
+                break;
+            case ArrivalProcess::UNIFORM:
+                time_ += 2.0 * mean * rng_.uniform();
+                break;
+            case ArrivalProcess::POISSON:
+                time_ += -mean * std::log(1.0 - rng_.uniform());
+                break;
+        }
+        return arrival;
+    }
+
+    GeneratorConfig config_;
+    Rng rng_;
+
+private:
+    double time_ = 0.0;
+};
+
+// ============================================================================
+// Address Patterns
+// ============================================================================
+
+/// Sequential stream: base, base + size, ... wrapping at the footprint
+class SequentialGenerator final : public Generator {
+public:
+    using Generator::Generator;
+
+protected:
+    Access next_access() override {
+        return {(index_++ % slots()) * config_.size, config_.size};
+    }
+
+    void restart() override { index_ = 0; }
+
+private:
+    uint64_t index_ = 0;
+};
+
+/// Strided stream: base, base + stride, ... wrapping at the footprint
+class StridedGenerator final : public Generator {
+public:
+    StridedGenerator(const GeneratorConfig& config, Address stride)
+        : Generator(config)
+        , stride_(stride)
+    {
+        if (stride == 0) {
+            throw std::invalid_argument("stride must be non-zero");
+        }
+    }
+
+protected:
+    Access next_access() override {
+        Address offset = offset_;
+        offset_ += stride_;
+        if (offset_ + config_.size > config_.footprint) {
+            // Next lap starts one request further so every slot is visited
+            lap_ += config_.size;
+            if (lap_ >= stride_ || lap_ + config_.size > config_.footprint) {
+                lap_ = 0;
+            }
+            offset_ = lap_;
+        }
+        return {offset, config_.size};
+    }
+
+    void restart() override {
+        offset_ = 0;
+        lap_ = 0;
+    }
+
+private:
+    Address stride_;
+    Address offset_ = 0;
+    Address lap_ = 0;
+};
+
+/// Uniformly random, size-aligned accesses over the footprint
+class RandomGenerator final : public Generator {
+public:
+    using Generator::Generator;
+
+protected:
+    Access next_access() override {
+        return {rng_.below(slots()) * config_.size, config_.size};
+    }
+};
+
+/// Zipfian hot set: slot k is accessed with probability proportional to
+/// 1 / (k + 1)^theta, so low addresses form the hot set
+///
+/// Uses the rejection-free method of Gray et al. ("Quickly Generating
+/// Billion-Record Synthetic Databases"), valid for 0 < theta < 1.
+class ZipfianGenerator final : public Generator {
+public:
+    ZipfianGenerator(const GeneratorConfig& config, double theta = 0.99)
+        : Generator(config)
+        , theta_(theta)
+    {
+        if (theta <= 0.0 || theta >= 1.0) {
+            throw std::invalid_argument("zipfian theta must be within (0, 1)");
+        }
+        const uint64_t n = slots();
+        for (uint64_t i = 1; i <= n; ++i) {
+            zeta_n_ += 1.0 / std::pow(static_cast<double>(i), theta);
+        }
+        double zeta_2 = 1.0 + std::pow(0.5, theta);
+        alpha_ = 1.0 / (1.0 - theta);
+        eta_ = (1.0 - std::pow(2.0 / static_cast<double>(n), 1.0 - theta)) /
+               (1.0 - zeta_2 / zeta_n_);
+    }
+
+    [[nodiscard]] double theta() const { return theta_; }
+
+protected:
+    Access next_access() override {
+        const uint64_t n = slots();
+        double u = rng_.uniform();
+        double uz = u * zeta_n_;
+        uint64_t rank;
+        if (uz < 1.0) {
+            rank = 0;
+        } else if (uz < 1.0 + std::pow(0.5, theta_)) {
+            rank = 1;
+        } else {
+            rank = static_cast<uint64_t>(static_cast<double>(n) * std::pow(eta_ * u - eta_ + 1.0, alpha_));
+        }
+        return {std::min(rank, n - 1) * config_.size, config_.size};
+    }
+
+private:
+    double theta_;
+    double zeta_n_ = 0.0;
+    double alpha_ = 0.0;
+    double eta_ = 0.0;
+};
+
+// ============================================================================
+// Tensor Walks
+// ============================================================================
+
+/// Row-major tensor of up to three dimensions (extents in elements,
+/// innermost last; unused leading dimensions are 1)
+struct TensorShape {
+    std::array<uint64_t, 3> extent = {1, 1, 1};
+    uint32_t element_bytes = 4;
+
+    [[nodiscard]] uint64_t bytes() const {
+        return extent[0] * extent[1] * extent[2] * element_bytes;
+    }
+};
+
+/// Tile-by-tile walk of a 2D/3D tensor (GEMM operand tiles)
+///
+/// Tiles are visited in row-major tile order; within a tile, each
+/// innermost-dimension row segment is read as contiguous requests of at
+/// most `size` bytes (the last one of a segment may be shorter). Edge tiles are clipped to the tensor. The walk
+/// repeats once the whole tensor has been covered; the footprint is
+/// taken from the tensor.
+class TileWalkGenerator final : public Generator {
+public:
+    TileWalkGenerator(GeneratorConfig config, const TensorShape& shape, std::array<uint64_t, 3> tile)
+        : Generator(with_footprint(config, shape.bytes()))
+        , shape_(shape)
+        , tile_(tile)
+    {
+        for (size_t d = 0; d < 3; ++d) {
+            if (shape.extent[d] == 0 || tile[d] == 0) {
+                throw std::invalid_argument("tensor and tile extents must be non-zero");
+            }
+            tiles_[d] = (shape.extent[d] + tile[d] - 1) / tile[d];
+        }
+    }
+
+protected:
+    Access next_access() override {
+        // Bounds of the current tile, clipped to the tensor
+        std::array<uint64_t, 3> origin{}, extent{};
+        for (size_t d = 0; d < 3; ++d) {
+            origin[d] = tile_index_[d] * tile_[d];
+            extent[d] = std::min(tile_[d], shape_.extent[d] - origin[d]);
+        }
+
+        uint64_t row_bytes = extent[2] * shape_.element_bytes;
+        uint64_t element = ((origin[0] + point_[0]) * shape_.extent[1] + origin[1] + point_[1]) *
+                           shape_.extent[2] + origin[2];
+        Access access{element * shape_.element_bytes + byte_,
+                      static_cast<uint32_t>(std::min<uint64_t>(config_.size, row_bytes - byte_))};
+
+        // Advance: bytes within the row segment, then rows, then tiles
+        byte_ += access.size;
+        if (byte_ >= row_bytes) {
+            byte_ = 0;
+            if (++point_[1] == extent[1]) {
+                point_[1] = 0;
+                if (++point_[0] == extent[0]) {
+                    point_[0] = 0;
+                    advance_tile();
+                }
+            }
+        }
+        return access;
+    }
+
+    void restart() override {
+        tile_index_ = {};
+        point_ = {};
+        byte_ = 0;
+    }
+
+private:
+    static GeneratorConfig with_footprint(GeneratorConfig config, uint64_t bytes) {
+        config.footprint = std::max<Address>(bytes, config.size);
+        return config;
+    }
+
+    void advance_tile() {
+        for (size_t d = 3; d-- > 0;) {
+            if (++tile_index_[d] < tiles_[d]) {
+                return;
+            }
+            tile_index_[d] = 0;
+        }
+    }
+
+    TensorShape shape_;
+    std::array<uint64_t, 3> tile_;
+    std::array<uint64_t, 3> tiles_{};
+    std::array<uint64_t, 3> tile_index_{};
+    std::array<uint64_t, 2> point_{};     ///< Position within the tile (outer two dims)
+    uint64_t byte_ = 0;                   ///< Position within the row segment
+};
+
+/// Convolution input layer (NCHW, batch of one, no padding)
+struct ConvShape {
+    uint64_t channels = 1;
+    uint64_t height = 1;
+    uint64_t width = 1;
+    uint64_t kernel_h = 1;
+    uint64_t kernel_w = 1;
+    uint64_t stride = 1;
+    uint32_t element_bytes = 4;
+
+    [[nodiscard]] uint64_t out_height() const { return (height - kernel_h) / stride + 1; }
+    [[nodiscard]] uint64_t out_width() const { return (width - kernel_w) / stride + 1; }
+    [[nodiscard]] uint64_t bytes() const { return channels * height * width * element_bytes; }
+};
+
+/// im2col walk of a convolution input
+///
+/// For each output pixel, reads its receptive field channel by channel:
+/// kernel_h row segments of kernel_w contiguous elements each. Overlapping
+/// windows re-read the same input, as an im2col lowering does.
+class Im2colGenerator final : public Generator {
+public:
+    Im2colGenerator(GeneratorConfig config, const ConvShape& shape)
+        : Generator(with_footprint(config, shape))
+        , shape_(shape)
+    {}
+
+protected:
+    Access next_access() override {
+        uint64_t iy = out_y_ * shape_.stride + r_;
+        uint64_t ix = out_x_ * shape_.stride;
+        uint64_t element = (c_ * shape_.height + iy) * shape_.width + ix;
+        uint64_t row_bytes = shape_.kernel_w * shape_.element_bytes;
+        Access access{element * shape_.element_bytes + byte_,
+                      static_cast<uint32_t>(std::min<uint64_t>(config_.size, row_bytes - byte_))};
+
+        byte_ += access.size;
+        if (byte_ >= row_bytes) {
+            byte_ = 0;
+            if (++r_ == shape_.kernel_h) {
+                r_ = 0;
+                if (++c_ == shape_.channels) {
+                    c_ = 0;
+                    if (++out_x_ == shape_.out_width()) {
+                        out_x_ = 0;
+                        if (++out_y_ == shape_.out_height()) {
+                            out_y_ = 0;
+                        }
+                    }
+                }
+            }
+        }
+        return access;
+    }
+
+    void restart() override {
+        out_y_ = out_x_ = c_ = r_ = byte_ = 0;
+    }
+
+private:
+    static GeneratorConfig with_footprint(GeneratorConfig config, const ConvShape& shape) {
+        if (shape.channels == 0 || shape.kernel_h == 0 || shape.kernel_w == 0 || shape.stride == 0 ||
+            shape.kernel_h > shape.height || shape.kernel_w > shape.width) {
+            throw std::invalid_argument("convolution kernel must fit inside the input");
+        }
+        config.footprint = std::max<Address>(shape.bytes(), config.size);
+        return config;
+    }
+
+    ConvShape shape_;
+    uint64_t out_y_ = 0;
+    uint64_t out_x_ = 0;
+    uint64_t c_ = 0;
+    uint64_t r_ = 0;
+    uint64_t byte_ = 0;
+};
+
+// ============================================================================
+// Multi-Stream Mix
+// ============================================================================
+
+/// Merges independent streams in arrival order
+///
+/// Each stream keeps its own pattern, read ratio, source and arrival
+/// process; the mix emits whichever stream's next request arrives first,
+/// breaking ties round-robin (so back-to-back streams interleave evenly).
+class MixGenerator final : public Generator {
+public:
+    explicit MixGenerator(std::vector<std::unique_ptr<Generator>> streams)
+        : Generator(GeneratorConfig{})
+        , streams_(std::move(streams))
+    {
+        if (streams_.empty()) {
+            throw std::invalid_argument("mix needs at least one stream");
+        }
+        prime();
+    }
+
+    Request next() override {
+        size_t pick = cursor_;
+        for (size_t i = 1; i < streams_.size(); ++i) {
+            size_t s = (cursor_ + i) % streams_.size();
+            if (head_[s].submit_cycle < head_[pick].submit_cycle) {
+                pick = s;
+            }
+        }
+        cursor_ = (pick + 1) % streams_.size();
+        Request request = std::move(head_[pick]);
+        head_[pick] = streams_[pick]->next();
+        return request;
+    }
+
+    void reset() override {
+        for (auto& stream : streams_) {
+            stream->reset();
+        }
+        prime();
+    }
+
+    [[nodiscard]] size_t num_streams() const { return streams_.size(); }
+
+protected:
+    Access next_access() override { return {}; }
+
+private:
+    void prime() {
+        head_.clear();
+        for (auto& stream : streams_) {
+            head_.push_back(stream->next());
+        }
+        cursor_ = 0;
+    }
+
+    std::vector<std::unique_ptr<Generator>> streams_;
+    std::vector<Request> head_;     ///< Next request of each stream
+    size_t cursor_ = 0;             ///< Round-robin tie breaker
+};
+
+// ============================================================================
+// Driving a Controller
+// ============================================================================
+
+/// Submit `count` requests from a generator, honouring their arrival cycles
+///
+/// Arrival cycles are offset by the controller's cycle at the call.
+/// Requests are generated in batches; the controller is ticked while the
+/// next request has not yet arrived or is back-pressured. Does not drain.
+inline uint64_t drive(IMemoryController& controller, Generator& generator,
+                      uint64_t count, size_t batch_size = 256) {
+    std::vector<Request> batch(std::max<size_t>(batch_size, 1));
+    const Cycle start = controller.cycle();
+    uint64_t submitted = 0;
+
+    while (submitted < count) {
+        size_t n = static_cast<size_t>(std::min<uint64_t>(batch.size(), count - submitted));
+        generator.fill(std::span(batch).first(n));
+        for (size_t i = 0; i < n; ++i) {
+            while (controller.cycle() < start + batch[i].submit_cycle) {
+                controller.tick();
+            }
+            while (!controller.submit(batch[i])) {
+                controller.tick();
+            }
+        }
+        submitted += n;
+    }
+    return submitted;
+}
+
+} // namespace sw::memsim::workload
@@ -0,0 +1,466 @@
+#pragma once
+
+#include <sw/memsim/workload/generator.hpp>
+
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace sw::memsim::workload {
+
+// ============================================================================
+// Operator Description
+// ============================================================================
+
+/// Element data type
+enum class DataType : uint8_t {
+    INT8,
+    FP16,
+    BF16,
+    FP32
+};
+
+constexpr std::string_view to_string(DataType type) {
+    switch (type) {
+        case DataType::INT8: return "INT8";
+        case DataType::FP16: return "FP16";
+        case DataType::BF16: return "BF16";
+        case DataType::FP32: return "FP32";
+    }
+    return "UNKNOWN";
+}
+
+constexpr uint32_t bytes_of(DataType type) {
+    switch (type) {
+        case DataType::INT8: return 1;
+        case DataType::FP16: return 2;
+        case DataType::BF16: return 2;
+        case DataType::FP32: return 4;
+    }
+    return 0;
+}
+
+/// Which operand stays on chip while the others stream
+enum class Dataflow : uint8_t {
+    OUTPUT_STATIONARY,   ///< Output tile accumulates over K, written once
+    WEIGHT_STATIONARY,   ///< Weight tile reused across M; partial sums spill
+    INPUT_STATIONARY     ///< Input tile reused across N; partial sums spill
+};
+
+constexpr std::string_view to_string(Dataflow dataflow) {
+    switch (dataflow) {
+        case Dataflow::OUTPUT_STATIONARY: return "OUTPUT_STATIONARY";
+        case Dataflow::WEIGHT_STATIONARY: return "WEIGHT_STATIONARY";
+        case Dataflow::INPUT_STATIONARY: return "INPUT_STATIONARY";
+    }
+    return "UNKNOWN";
+}
+
+/// C[M x N] = A[M x K] * B[K x N], all row-major
+struct GemmShape {
+    uint64_t m = 1;
+    uint64_t n = 1;
+    uint64_t k = 1;
+};
+
+/// 2D convolution (NCHW input and output, OIHW weights, zero padding)
+///
+/// Lowered to an implicit GEMM: M = batch * out_height * out_width,
+/// N = out_channels, K = in_channels * kernel_h * kernel_w. Input tiles are
+/// fetched from the input tensor itself (no im2col buffer in DRAM) and
+/// padding elements are not fetched.
+struct ConvLayer {
+    uint64_t batch = 1;
+    uint64_t in_channels = 1;
+    uint64_t height = 1;
+    uint64_t width = 1;
+    uint64_t out_channels = 1;
+    uint64_t kernel_h = 1;
+    uint64_t kernel_w = 1;
+    uint64_t stride = 1;
+    uint64_t padding = 0;
+
+    [[nodiscard]] uint64_t out_height() const { return (height + 2 * padding - kernel_h) / stride + 1; }
+    [[nodiscard]] uint64_t out_width() const { return (width + 2 * padding - kernel_w) / stride + 1; }
+
+    [[nodiscard]] GemmShape gemm() const {
+        return {batch * out_height() * out_width(), out_channels, in_channels * kernel_h * kernel_w};
+    }
+};
+
+/// On-chip tile sizes and loop order
+struct Tiling {
+    uint64_t m = 64;
+    uint64_t n = 64;
+    uint64_t k = 64;
+    Dataflow dataflow = Dataflow::OUTPUT_STATIONARY;
+};
+
+/// Data types of the three operands
+struct Precision {
+    DataType input = DataType::FP16;     ///< A (activations)
+    DataType weight = DataType::FP16;    ///< B (weights)
+    DataType output = DataType::FP32;    ///< C (outputs and partial sums)
+};
+
+/// DRAM traffic of one pass over an operator
+struct OperatorTraffic {
+    uint64_t read_requests = 0;
+    uint64_t write_requests = 0;
+    uint64_t read_bytes = 0;
+    uint64_t write_bytes = 0;
+    uint64_t macs = 0;
+
+    /// MACs per byte of DRAM traffic
+    [[nodiscard]] double arithmetic_intensity() const {
+        uint64_t bytes = read_bytes + write_bytes;
+        return bytes > 0 ? static_cast<double>(macs) / static_cast<double>(bytes) : 0.0;
+    }
+};
+
+// ============================================================================
+// Tensor Operator Generator
+// ============================================================================
+
+/// DRAM request stream of a tiled GEMM or convolution layer
+///
+/// Walks the tile loop nest of the chosen dataflow and emits the line
+/// requests of every tile load and store, one loop iteration at a time, so
+/// no trace is materialized. Each tile transfer fetches the distinct
+/// `size`-byte lines its elements touch, in ascending address order.
+///
+/// Loop nests (outermost first; reads happen when the tile is not already
+/// on chip):
+/// - OUTPUT_STATIONARY: m, n, k - A and B every step, C written after the
+///   last k
+/// - WEIGHT_STATIONARY: n, k, m - B once per (n, k); A every step; C read
+///   back for k > 0 and written every step
+/// - INPUT_STATIONARY:  m, k, n - A once per (m, k); B every step; C read
+///   back for k > 0 and written every step
+///
+/// Operands are laid out from `base`: A, then B, then C, each 4 KB aligned.
+/// After the last step the next pass (inference) begins. The generator's
+/// read_ratio is ignored; arrival process and source apply as usual.
+class TensorOperatorGenerator final : public Generator {
+public:
+    TensorOperatorGenerator(const GeneratorConfig& config, const GemmShape& gemm,
+                            const Tiling& tiling, const Precision& precision = {})
+        : TensorOperatorGenerator(config, gemm, std::nullopt, tiling, precision)
+    {}
+
+    TensorOperatorGenerator(const GeneratorConfig& config, const ConvLayer& conv,
+                            const Tiling& tiling, const Precision& precision = {})
+        : TensorOperatorGenerator(config, validated(conv).gemm(), conv, tiling, precision)
+    {}
+
+    Request next() override {
+        while (cursor_ == pending_.size()) {
+            plan_step();
+        }
+        const Transfer& transfer = pending_[cursor_++];
+        if (cursor_ == pending_.size() && closes_pass_) {
+            passes_++;
+        }
+        Request request;
+        request.address = transfer.address;
+        request.size = config_.size;
+        request.source = config_.source;
+        request.type = transfer.type;
+        request.submit_cycle = next_arrival();
+        return request;
+    }
+
+    void reset() override {
+        Generator::reset();
+        step_ = {};
+        pending_.clear();
+        cursor_ = 0;
+        closes_pass_ = false;
+        passes_ = 0;
+    }
+
+    [[nodiscard]] const GemmShape& shape() const { return gemm_; }
+    [[nodiscard]] const Tiling& tiling() const { return tiling_; }
+    [[nodiscard]] const Precision& precision() const { return precision_; }
+
+    /// Base addresses of A, B and C
+    [[nodiscard]] Address input_base() const { return a_base_; }
+    [[nodiscard]] Address weight_base() const { return b_base_; }
+    [[nodiscard]] Address output_base() const { return c_base_; }
+
+    /// Passes whose requests have all been emitted
+    [[nodiscard]] uint64_t passes() const { return passes_; }
+
+    /// Traffic of one full pass (walks the loop nest of a copy)
+    [[nodiscard]] OperatorTraffic pass_traffic() const {
+        TensorOperatorGenerator walk(*this);
+        walk.reset();
+        OperatorTraffic traffic;
+        traffic.macs = gemm_.m * gemm_.n * gemm_.k;
+        bool last = false;
+        while (!last) {
+            last = walk.plan_step();
+            for (const auto& transfer : walk.pending_) {
+                if (transfer.type == RequestType::READ) {
+                    traffic.read_requests++;
+                    traffic.read_bytes += config_.size;
+                } else {
+                    traffic.write_requests++;
+                    traffic.write_bytes += config_.size;
+                }
+            }
+        }
+        return traffic;
+    }
+
+protected:
+    Access next_access() override { return {}; }
+
+private:
+    enum class Operand : uint8_t { A, B, C };
+
+    struct Transfer {
+        Address address;
+        RequestType type;
+    };
+
+    /// Tile loop counters (tile indices)
+    struct Step {
+        uint64_t m = 0;
+        uint64_t n = 0;
+        uint64_t k = 0;
+    };
+
+    TensorOperatorGenerator(const GeneratorConfig& config, const GemmShape& gemm,
+                            std::optional<ConvLayer> conv, const Tiling& tiling,
+                            const Precision& precision)
+        : Generator(config)
+        , gemm_(gemm)
+        , conv_(conv)
+        , tiling_(tiling)
+        , precision_(precision)
+    {
+        if (gemm.m == 0 || gemm.n == 0 || gemm.k == 0) {
+            throw std::invalid_argument("operator dimensions must be non-zero");
+        }
+        if (tiling.m == 0 || tiling.n == 0 || tiling.k == 0) {
+            throw std::invalid_argument("tile sizes must be non-zero");
+        }
+        tiles_ = {ceil_div(gemm.m, tiling.m), ceil_div(gemm.n, tiling.n), ceil_div(gemm.k, tiling.k)};
+
+        uint64_t a_bytes, b_bytes;
+        if (conv_) {
+            a_bytes = conv_->batch * conv_->in_channels * conv_->height * conv_->width * bytes_of(precision.input);
+        } else {
+            a_bytes = gemm.m * gemm.k * bytes_of(precision.input);
+        }
+        b_bytes = gemm.k * gemm.n * bytes_of(precision.weight);
+        a_base_ = config.base;
+        b_base_ = align(a_base_ + a_bytes);
+        c_base_ = align(b_base_ + b_bytes);
+    }
+
+    static const ConvLayer& validated(const ConvLayer& conv) {
+        if (conv.in_channels == 0 || conv.out_channels == 0 || conv.batch == 0 ||
+            conv.kernel_h == 0 || conv.kernel_w == 0 || conv.stride == 0 ||
+            conv.kernel_h > conv.height + 2 * conv.padding ||
+            conv.kernel_w > conv.width + 2 * conv.padding) {
+            throw std::invalid_argument("convolution kernel must fit inside the padded input");
+        }
+        return conv;
+    }
+
+    static uint64_t ceil_div(uint64_t a, uint64_t b) { return (a + b - 1) / b; }
+    static Address align(Address a) { return (a + 4095) & ~Address{4095}; }
+
+    // ========================================================================
+    // Loop Nest
+    // ========================================================================
+
+    /// Queue the transfers of the current loop iteration and advance;
+    /// returns true for the last iteration of a pass
+    bool plan_step() {
+        pending_.clear();
+        cursor_ = 0;
+        const Step s = step_;
+        const bool first_k = s.k == 0;
+        const bool last_k = s.k + 1 == tiles_[2];
+
+        switch (tiling_.dataflow) {
+            case Dataflow::OUTPUT_STATIONARY:
+                load_tile(Operand::A, s);
+                load_tile(Operand::B, s);
+                if (last_k) {
+                    store_tile(s);
+                }
+                break;
+            case Dataflow::WEIGHT_STATIONARY:
+                if (s.m == 0) {
+                    load_tile(Operand::B, s);
+                }
+                load_tile(Operand::A, s);
+                if (!first_k) {
+                    load_tile(Operand::C, s);
+                }
+                store_tile(s);
+                break;
+            case Dataflow::INPUT_STATIONARY:
+                if (s.n == 0) {
+                    load_tile(Operand::A, s);
+                }
+                load_tile(Operand::B, s);
+                if (!first_k) {
+                    load_tile(Operand::C, s);
+                }
+                store_tile(s);
+                break;
+        }
+        closes_pass_ = advance();
+        return closes_pass_;
+    }
+
+    /// Advance the counters in the dataflow's loop order (innermost first);
+    /// returns true when the loop nest wraps
+    bool advance() {
+        std::array<uint64_t*, 3> order{};   // innermost to outermost
+        std::array<uint64_t, 3> bound{};
+        switch (tiling_.dataflow) {
+            case Dataflow::OUTPUT_STATIONARY:
+                order = {&step_.k, &step_.n, &step_.m};
+                bound = {tiles_[2], tiles_[1], tiles_[0]};
+                break;
+            case Dataflow::WEIGHT_STATIONARY:
+                order = {&step_.m, &step_.k, &step_.n};
+                bound = {tiles_[0], tiles_[2], tiles_[1]};
+                break;
+            case Dataflow::INPUT_STATIONARY:
+                order = {&step_.n, &step_.k, &step_.m};
+                bound = {tiles_[1], tiles_[2], tiles_[0]};
+                break;
+        }
+        for (size_t i = 0; i < 3; ++i) {
+            if (++*order[i] < bound[i]) {
+                return false;
+            }
+            *order[i] = 0;
+        }
+        return true;
+    }
+
+    // ========================================================================
+    // Tile Transfers
+    // ========================================================================
+
+    void load_tile(Operand operand, const Step& s) { transfer(operand, s, RequestType::READ); }
+    void store_tile(const Step& s) { transfer(Operand::C, s, RequestType::WRITE); }
+
+    /// Queue the distinct lines touched by one operand tile
+    void transfer(Operand operand, const Step& s, RequestType type) {
+        // Element ranges of the two tile dimensions of this operand
+        uint64_t m0 = s.m * tiling_.m, m1 = std::min(m0 + tiling_.m, gemm_.m);
+        uint64_t n0 = s.n * tiling_.n, n1 = std::min(n0 + tiling_.n, gemm_.n);
+        uint64_t k0 = s.k * tiling_.k, k1 = std::min(k0 + tiling_.k, gemm_.k);
+
+        lines_.clear();
+        const Address line = config_.size;
+        auto touch = [&](std::optional<Address> address) {
+            if (address) {
+                Address first = *address / line;
+                if (lines_.empty() || lines_.back() != first) {
+                    lines_.push_back(first);
+                }
+            }
+        };
+        switch (operand) {
+            case Operand::A:
+                for (uint64_t m = m0; m < m1; ++m) {
+                    for (uint64_t k = k0; k < k1; ++k) {
+                        touch(a_address(m, k));
+                    }
+                }
+                break;
+            case Operand::B:
+                for (uint64_t k = k0; k < k1; ++k) {
+                    for (uint64_t n = n0; n < n1; ++n) {
+                        touch(b_address(k, n));
+                    }
+                }
+                break;
+            case Operand::C:
+                for (uint64_t m = m0; m < m1; ++m) {
+                    for (uint64_t n = n0; n < n1; ++n) {
+                        touch(c_address(m, n));
+                    }
+                }
+                break;
+        }
+        std::sort(lines_.begin(), lines_.end());
+        lines_.erase(std::unique(lines_.begin(), lines_.end()), lines_.end());
+        for (Address l : lines_) {
+            pending_.push_back({l * line, type});
+        }
+    }
+
+    // ========================================================================
+    // Operand Layouts
+    // ========================================================================
+
+    /// Input element address (nullopt for convolution padding)
+    std::optional<Address> a_address(uint64_t m, uint64_t k) const {
+        const uint32_t eb = bytes_of(precision_.input);
+        if (!conv_) {
+            return a_base_ + (m * gemm_.k + k) * eb;
+        }
+        const ConvLayer& c = *conv_;
+        uint64_t ow = c.out_width(), oh = c.out_height();
+        uint64_t ox = m % ow, oy = (m / ow) % oh, b = m / (ow * oh);
+        uint64_t s = k % c.kernel_w, r = (k / c.kernel_w) % c.kernel_h, ch = k / (c.kernel_w * c.kernel_h);
+        uint64_t iy = oy * c.stride + r, ix = ox * c.stride + s;
+        if (iy < c.padding || ix < c.padding || iy - c.padding >= c.height || ix - c.padding >= c.width) {
+            return std::nullopt;
+        }
+        iy -= c.padding;
+        ix -= c.padding;
+        return a_base_ + (((b * c.in_channels + ch) * c.height + iy) * c.width + ix) * eb;
+    }
+
+    /// Weight element address (GEMM: K x N row-major; conv: OIHW)
+    Address b_address(uint64_t k, uint64_t n) const {
+        const uint32_t eb = bytes_of(precision_.weight);
+        return conv_ ? b_base_ + (n * gemm_.k + k) * eb
+                     : b_base_ + (k * gemm_.n + n) * eb;
+    }
+
+    /// Output element address (GEMM: M x N row-major; conv: NCHW)
+    Address c_address(uint64_t m, uint64_t n) const {
+        const uint32_t eb = bytes_of(precision_.output);
+        if (!conv_) {
+            return c_base_ + (m * gemm_.n + n) * eb;
+        }
+        uint64_t pixels = conv_->out_height() * conv_->out_width();
+        uint64_t b = m / pixels, p = m % pixels;
+        return c_base_ + ((b * gemm_.n + n) * pixels + p) * eb;
+    }
+
+    GemmShape gemm_;
+    std::optional<ConvLayer> conv_;
+    Tiling tiling_;
+    Precision precision_;
+    std::array<uint64_t, 3> tiles_{};     ///< Tile counts along M, N, K
+
+    Address a_base_ = 0;
+    Address b_base_ = 0;
+    Address c_base_ = 0;
+
+    Step step_;
+    std::vector<Transfer> pending_;       ///< Transfers of the current step
+    size_t cursor_ = 0;
+    bool closes_pass_ = false;            ///< Current step is the last of a pass
+    std::vector<Address> lines_;          ///< Scratch for tile line sets
+    uint64_t passes_ = 0;
+};
+
+} // namespace sw::memsim::workload
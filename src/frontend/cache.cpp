@@ -0,0 +1,275 @@
+#include <sw/memsim/frontend/cache.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace sw::memsim {
+
+CacheController::CacheController(const CacheConfig& config,
+                                 std::unique_ptr<IMemoryController> backing)
+    : ControllerDecorator(std::move(backing))
+    , cache_config_(config)
+    , tags_(config.num_sets(), config.ways)
+    , mshrs_(config.mshrs, config.mshr_targets)
+    , mshr_issue_(config.mshrs, 0)
+    , accesses_(config.queue_depth)
+    , line_shift_(static_cast<unsigned>(std::countr_zero(config.line_bytes)))
+{
+    if (!std::has_single_bit(config.line_bytes) ||
+        config.num_sets() == 0 || !std::has_single_bit(config.num_sets())) {
+        throw std::invalid_argument("cache line size and set count must be powers of two");
+    }
+    if (config.ways == 0 || config.ways > 64) {
+        throw std::invalid_argument("cache associativity must be between 1 and 64");
+    }
+}
+
+std::optional<RequestId> CacheController::submit(Request request) {
+    if (accesses_.full()) {
+        return std::nullopt;
+    }
+
+    request.id = next_id_++;
+    request.submit_cycle = current_cycle_;
+
+    Access access;
+    access.next_line = line_of(request.address);
+    access.end_line = line_of(request.address + std::max<uint32_t>(request.size, 1) - 1) + 1;
+    access.lines_left = static_cast<uint32_t>(access.end_line - access.next_line);
+    access.request = std::move(request);
+
+    Access* pooled = accesses_.acquire(std::move(access));
+    feeding_.push_back(static_cast<uint32_t>(accesses_.index_of(pooled)));
+    RequestId id = pooled->request.id;
+
+    feed();
+    return id;
+}
+
+bool CacheController::can_accept() const {
+    return !accesses_.full();
+}
+
+bool CacheController::has_pending() const {
+    return !accesses_.empty() || !outbound_.empty() ||
+           !pending_fills_.empty() || backing_->has_pending();
+}
+
+size_t CacheController::pending_count() const {
+    return accesses_.in_use();
+}
+
+void CacheController::tick() {
+    current_cycle_++;
+    backing_->tick();
+
+    // 1. Look up lines of admitted requests (stalls on MSHR exhaustion)
+    feed();
+
+    // 2. Send fills and writes to the backing controller
+    issue_outbound();
+
+    // 3. Install returned lines and complete their targets
+    while (!fills_.empty() && fills_.top().ready <= current_cycle_) {
+        uint32_t mshr = fills_.top().mshr;
+        fills_.pop();
+        install(mshr);
+    }
+
+    // 4. Complete hits whose latency has elapsed
+    while (!hits_.empty() && hits_.front().ready <= current_cycle_) {
+        uint32_t access = hits_.front().access;
+        hits_.pop_front();
+        complete_line(access);
+    }
+}
+
+void CacheController::reset() {
+    current_cycle_ = 0;
+    next_id_ = 1;
+    stamp_ = 0;
+    tags_.invalidate_all();
+    mshrs_.clear();
+    accesses_.clear();
+    feeding_.clear();
+    hits_.clear();
+    fills_ = {};
+    outbound_.clear();
+    pending_fills_.clear();
+    backing_->reset();
+    stats_.reset();
+    cache_stats_.reset();
+}
+
+void CacheController::flush() {
+    for (uint32_t set = 0; set < tags_.sets(); ++set) {
+        for (uint32_t way = 0; way < tags_.ways(); ++way) {
+            if (tags_.valid(set, way) && tags_.dirty(set, way)) {
+                send_write(address_of(tags_.line(set, way)), cache_config_.line_bytes);
+                tags_.clear_dirty(set, way);
+                cache_stats_.writebacks++;
+            }
+        }
+    }
+}
+
+void CacheController::feed() {
+    while (!feeding_.empty()) {
+        uint32_t idx = feeding_.front();
+        Access& access = *accesses_.at(idx);
+
+        while (access.next_line < access.end_line) {
+            if (!lookup(idx, access.next_line)) {
+                return;  // Retry next cycle, preserving order
+            }
+            access.next_line++;
+        }
+        feeding_.pop_front();
+    }
+}
+
+bool CacheController::lookup(uint32_t idx, Address line) {
+    const Request& request = accesses_.at(idx)->request;
+    bool is_read = request.type == RequestType::READ;
+    uint32_t set = tags_.set_of(line);
+    int way = tags_.find(set, line);
+
+    if (way >= 0) {
+        // Hit
+        (is_read ? cache_stats_.read_hits : cache_stats_.write_hits)++;
+        tags_.touch(set, static_cast<uint32_t>(way), ++stamp_);
+        if (!is_read) {
+            if (cache_config_.write_policy == WritePolicy::WRITE_BACK) {
+                tags_.set_dirty(set, static_cast<uint32_t>(way));
+            } else {
+                write_through(request, line);
+            }
+        }
+        hits_.push_back({current_cycle_ + cache_config_.hit_latency, idx});
+        return true;
+    }
+
+    if (!allocates(request.type)) {
+        // No-write-allocate miss: forward the write, complete as posted
+        cache_stats_.write_misses++;
+        write_through(request, line);
+        hits_.push_back({current_cycle_ + cache_config_.hit_latency, idx});
+        return true;
+    }
+
+    // Miss: merge into an outstanding fill or allocate a new one
+    if (auto mshr = mshrs_.find(line)) {
+        if (!mshrs_.add_target(*mshr, idx)) {
+            cache_stats_.mshr_stalls++;
+            return false;
+        }
+        cache_stats_.mshr_merges++;
+    } else {
+        mshr = mshrs_.allocate(line);
+        if (!mshr) {
+            cache_stats_.mshr_stalls++;
+            return false;
+        }
+        mshrs_.add_target(*mshr, idx);
+        pending_fills_.push_back(*mshr);
+    }
+
+    (is_read ? cache_stats_.read_misses : cache_stats_.write_misses)++;
+    return true;
+}
+
+void CacheController::install(uint32_t mshr) {
+    Address line = mshrs_.line(mshr);
+    uint32_t set = tags_.set_of(line);
+    uint32_t way = tags_.victim(set);
+
+    if (tags_.valid(set, way)) {
+        cache_stats_.evictions++;
+        if (tags_.dirty(set, way)) {
+            send_write(address_of(tags_.line(set, way)), cache_config_.line_bytes);
+            cache_stats_.writebacks++;
+        }
+    }
+    tags_.install(set, way, line, ++stamp_);
+
+    for (uint32_t idx : mshrs_.targets(mshr)) {
+        const Request& request = accesses_.at(idx)->request;
+        if (request.type == RequestType::WRITE) {
+            if (cache_config_.write_policy == WritePolicy::WRITE_BACK) {
+                tags_.set_dirty(set, way);
+            } else {
+                write_through(request, line);
+            }
+        }
+        complete_line(idx);
+    }
+    mshrs_.release(mshr);
+}
+
+void CacheController::complete_line(uint32_t idx) {
+    Access& access = *accesses_.at(idx);
+    if (--access.lines_left > 0) {
+        return;
+    }
+
+    RequestType type = access.request.type;
+    Cycle latency = current_cycle_ - access.request.submit_cycle;
+    CompletionCallback callback = std::move(access.request.callback);
+
+    // Release first so the callback may submit follow-up requests
+    accesses_.release(&access);
+    stats_.record_completion(type, latency);
+    if (callback) {
+        callback(latency);
+    }
+}
+
+void CacheController::write_through(const Request& request, Address line) {
+    // Only the bytes of this request that fall within the line
+    Address line_start = address_of(line);
+    Address line_end = line_start + cache_config_.line_bytes;
+    Address start = std::max(request.address, line_start);
+    Address end = std::min(request.address + std::max<uint32_t>(request.size, 1), line_end);
+
+    send_write(start, static_cast<uint32_t>(end - start));
+    cache_stats_.write_throughs++;
+}
+
+void CacheController::send_write(Address address, uint32_t size) {
+    Request write;
+    write.address = address;
+    write.size = size;
+    write.type = RequestType::WRITE;
+    outbound_.push_back(std::move(write));
+}
+
+void CacheController::issue_outbound() {
+    // Fills first: they are on the requester's critical path
+    while (!pending_fills_.empty()) {
+        uint32_t mshr = pending_fills_.front();
+        mshr_issue_[mshr] = current_cycle_;
+
+        Request fill;
+        fill.address = address_of(mshrs_.line(mshr));
+        fill.size = cache_config_.line_bytes;
+        fill.type = RequestType::READ;
+        fill.callback = [this, mshr](Cycle latency) {
+            fills_.push({mshr_issue_[mshr] + latency, mshr});
+        };
+
+        if (!backing_->submit(std::move(fill))) {
+            break;
+        }
+        pending_fills_.pop_front();
+        cache_stats_.fills++;
+    }
+
+    while (!outbound_.empty()) {
+        if (!backing_->submit(outbound_.front())) {
+            break;
+        }
+        outbound_.pop_front();
+    }
+}
+
+} // namespace sw::memsim
@@ -0,0 +1,375 @@
+#include <sw/memsim/frontend/prefetcher.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+namespace sw::memsim {
+
+PrefetchController::PrefetchController(const PrefetchConfig& config,
+                                       std::unique_ptr<IMemoryController> backing)
+    : ControllerDecorator(std::move(backing))
+    , prefetch_config_(config)
+    , line_shift_(static_cast<unsigned>(std::countr_zero(config.line_bytes)))
+    , streams_(static_cast<size_t>(config.max_sources) * config.streams_per_source)
+    , strides_(config.max_sources)
+    , inflight_(config.max_outstanding, config.late_targets)
+    , issue_cycle_(config.max_outstanding, 0)
+    , inflight_used_(config.max_outstanding, 0)
+    , inflight_stale_(config.max_outstanding, 0)
+    , demands_(config.queue_depth)
+{
+    if (!std::has_single_bit(config.line_bytes)) {
+        throw std::invalid_argument("prefetch line size must be a power of two");
+    }
+    if (config.max_sources == 0 || config.streams_per_source == 0) {
+        throw std::invalid_argument("prefetcher must track at least one source and stream");
+    }
+}
+
+std::optional<RequestId> PrefetchController::submit(Request request) {
+    if (request.type == RequestType::READ) {
+        return submit_read(std::move(request));
+    }
+
+    // Buffered copies of written lines are stale
+    Address first = line_of(request.address);
+    Address last = line_of(request.address + std::max<uint32_t>(request.size, 1) - 1);
+    for (Address line = first; line <= last; ++line) {
+        invalidate(line);
+    }
+    return pass_through(std::move(request));
+}
+
+bool PrefetchController::has_pending() const {
+    return !demands_.empty() || !inflight_.empty() || !fills_.empty() ||
+           backing_->has_pending();
+}
+
+size_t PrefetchController::pending_count() const {
+    return backing_->pending_count() + demands_.in_use();
+}
+
+void PrefetchController::tick() {
+    backing_->tick();
+    Cycle now = cycle();
+
+    // 1. Buffer returned prefetches and complete demands waiting on them
+    while (!fills_.empty() && fills_.top().ready <= now) {
+        uint32_t entry = fills_.top().entry;
+        fills_.pop();
+        install(entry);
+    }
+
+    // 2. Complete buffer hits whose latency has elapsed
+    while (!hits_.empty() && hits_.front().ready <= now) {
+        uint32_t demand = hits_.front().demand;
+        hits_.pop_front();
+        complete_demand(demand, now - demands_.at(demand)->submit_cycle);
+    }
+}
+
+void PrefetchController::reset() {
+    std::fill(streams_.begin(), streams_.end(), Stream{});
+    std::fill(strides_.begin(), strides_.end(), StrideEntry{});
+    lru_clock_ = 0;
+    inflight_.clear();
+    ready_.clear();
+    ready_order_.clear();
+    buffer_stamp_ = 0;
+    demands_.clear();
+    hits_.clear();
+    fills_ = {};
+    next_id_ = 1;
+    backing_->reset();
+    stats_.reset();
+    prefetch_stats_.reset();
+}
+
+// ============================================================================
+// Demand Path
+// ============================================================================
+
+std::optional<RequestId> PrefetchController::submit_read(Request request) {
+    Address first = line_of(request.address);
+    Address last = line_of(request.address + std::max<uint32_t>(request.size, 1) - 1);
+    uint16_t source = request.source;
+    Address address = request.address;
+
+    std::optional<RequestId> id;
+    if (first == last && ready_.count(first)) {
+        id = serve(std::move(request), std::nullopt);
+    } else if (auto entry = (first == last) ? inflight_.find(first) : std::nullopt;
+               entry && !inflight_stale_[*entry] && inflight_.has_target_space(*entry)) {
+        // A fill issued before a write to the line would return stale data
+        id = serve(std::move(request), entry);
+    } else {
+        id = pass_through(std::move(request));
+    }
+
+    if (id) {
+        prefetch_stats_.demand_reads++;
+        train(source, address);
+    }
+    return id;
+}
+
+std::optional<RequestId> PrefetchController::serve(Request request,
+                                                   std::optional<uint32_t> inflight) {
+    if (demands_.full()) {
+        return std::nullopt;
+    }
+
+    Address line = line_of(request.address);
+    request.id = next_id_++;
+    request.submit_cycle = cycle();
+    RequestId id = request.id;
+    Request* demand = demands_.acquire(std::move(request));
+    uint32_t idx = static_cast<uint32_t>(demands_.index_of(demand));
+
+    if (inflight) {
+        // Late prefetch: wait for the fill
+        inflight_.add_target(*inflight, idx);
+        if (!inflight_used_[*inflight]) {
+            inflight_used_[*inflight] = 1;
+            prefetch_stats_.useful++;
+            prefetch_stats_.late++;
+        }
+    } else {
+        BufferedLine& buffered = ready_.at(line);
+        if (!buffered.used) {
+            buffered.used = true;
+            prefetch_stats_.useful++;
+        }
+        hits_.push_back({cycle() + prefetch_config_.hit_latency, idx});
+    }
+    prefetch_stats_.covered++;
+    return id;
+}
+
+std::optional<RequestId> PrefetchController::pass_through(Request request) {
+    RequestType type = request.type;
+    request.callback = [this, type, callback = std::move(request.callback)](Cycle latency) {
+        stats_.record_completion(type, latency);
+        if (callback) {
+            callback(latency);
+        }
+    };
+    if (!backing_->submit(std::move(request))) {
+        return std::nullopt;
+    }
+    return next_id_++;
+}
+
+void PrefetchController::complete_demand(uint32_t demand, Cycle latency) {
+    Request* request = demands_.at(demand);
+    RequestType type = request->type;
+    CompletionCallback callback = std::move(request->callback);
+
+    // Release first so the callback may submit follow-up requests
+    demands_.release(request);
+    stats_.record_completion(type, latency);
+    if (callback) {
+        callback(latency);
+    }
+}
+
+// ============================================================================
+// Detectors
+// ============================================================================
+
+void PrefetchController::train(uint32_t source, Address address) {
+    source %= prefetch_config_.max_sources;
+    if (prefetch_config_.stream) {
+        train_stream(source, line_of(address));
+    }
+    if (prefetch_config_.stride) {
+        train_stride(source, address);
+    }
+}
+
+void PrefetchController::train_stream(uint32_t source, Address line) {
+    Stream* table = &streams_[static_cast<size_t>(source) * prefetch_config_.streams_per_source];
+    Stream* victim = table;
+    lru_clock_++;
+
+    for (uint32_t i = 0; i < prefetch_config_.streams_per_source; ++i) {
+        Stream& stream = table[i];
+        if (!stream.valid) {
+            victim = &stream;
+            continue;
+        }
+        if (stream.last_line == line) {
+            stream.lru = lru_clock_;   // Another access within the same line
+            return;
+        }
+        int8_t direction = (line == stream.last_line + 1) ? 1
+                         : (line + 1 == stream.last_line) ? -1 : 0;
+        if (direction != 0) {
+            if (stream.direction == direction) {
+                stream.confidence = static_cast<uint8_t>(std::min(stream.confidence + 1, 255));
+            } else {
+                stream.direction = direction;
+                stream.confidence = 1;
+            }
+            stream.last_line = line;
+            stream.lru = lru_clock_;
+
+            if (stream.confidence >= prefetch_config_.confidence) {
+                for (uint32_t k = 0; k < prefetch_config_.degree; ++k) {
+                    Address ahead = prefetch_config_.distance + k;
+                    if (direction < 0 && ahead > line) {
+                        break;
+                    }
+                    issue_prefetch(direction > 0 ? line + ahead : line - ahead);
+                }
+            }
+            return;
+        }
+        if (victim->valid && stream.lru < victim->lru) {
+            victim = &stream;
+        }
+    }
+
+    // No stream continues here: start a new one
+    *victim = Stream{line, 0, 0, true, lru_clock_};
+}
+
+void PrefetchController::train_stride(uint32_t source, Address address) {
+    StrideEntry& entry = strides_[source];
+    if (!entry.valid) {
+        entry = StrideEntry{address, 0, 0, true};
+        return;
+    }
+
+    int64_t delta = static_cast<int64_t>(address - entry.last);
+    if (delta == 0) {
+        return;
+    }
+    if (delta == entry.stride) {
+        entry.confidence = static_cast<uint8_t>(std::min(entry.confidence + 1, 255));
+    } else {
+        entry.stride = delta;
+        entry.confidence = 1;
+    }
+    entry.last = address;
+
+    // Sub-line strides are sequential streams; leave them to the stream detector
+    uint64_t magnitude = static_cast<uint64_t>(delta < 0 ? -delta : delta);
+    if (entry.confidence < prefetch_config_.confidence || magnitude < prefetch_config_.line_bytes) {
+        return;
+    }
+    for (uint32_t k = 0; k < prefetch_config_.degree; ++k) {
+        uint64_t offset = magnitude * (prefetch_config_.distance + k);
+        if (delta < 0 && offset > address) {
+            break;
+        }
+        issue_prefetch(line_of(delta > 0 ? address + offset : address - offset));
+    }
+}
+
+// ============================================================================
+// Prefetch Path
+// ============================================================================
+
+void PrefetchController::issue_prefetch(Address line) {
+    if (ready_.count(line) || inflight_.find(line)) {
+        return;
+    }
+    if (inflight_.full() || !backing_->can_accept()) {
+        prefetch_stats_.dropped++;
+        return;
+    }
+
+    uint32_t entry = *inflight_.allocate(line);
+    issue_cycle_[entry] = cycle();
+    inflight_used_[entry] = 0;
+    inflight_stale_[entry] = 0;
+
+    Request prefetch;
+    prefetch.address = line << line_shift_;
+    prefetch.size = prefetch_config_.line_bytes;
+    prefetch.type = RequestType::READ;
+    prefetch.priority = Priority::LOW;
+    prefetch.callback = [this, entry](Cycle latency) {
+        fills_.push({issue_cycle_[entry] + latency, entry});
+    };
+
+    if (!backing_->submit(std::move(prefetch))) {
+        inflight_.release(entry);
+        prefetch_stats_.dropped++;
+        return;
+    }
+    prefetch_stats_.issued++;
+}
+
+void PrefetchController::install(uint32_t entry) {
+    Address line = inflight_.line(entry);
+    bool used = inflight_used_[entry] != 0;
+    bool stale = inflight_stale_[entry] != 0;
+
+    // Detach targets first so callbacks may issue new reads to this line
+    auto span = inflight_.targets(entry);
+    std::vector<uint32_t> targets(span.begin(), span.end());
+    inflight_.release(entry);
+
+    if (!stale) {
+        buffer(line, used);
+    } else if (!used) {
+        prefetch_stats_.unused++;
+    }
+
+    Cycle now = cycle();
+    for (uint32_t demand : targets) {
+        complete_demand(demand, now - demands_.at(demand)->submit_cycle);
+    }
+}
+
+void PrefetchController::buffer(Address line, bool used) {
+    if (prefetch_config_.buffer_lines == 0) {
+        if (!used) {
+            prefetch_stats_.unused++;
+        }
+        return;
+    }
+
+    uint64_t stamp = ++buffer_stamp_;
+    ready_[line] = BufferedLine{stamp, used};
+    ready_order_.emplace_back(line, stamp);
+
+    while (ready_.size() > prefetch_config_.buffer_lines) {
+        auto [victim, victim_stamp] = ready_order_.front();
+        ready_order_.pop_front();
+        auto it = ready_.find(victim);
+        if (it == ready_.end() || it->second.stamp != victim_stamp) {
+            continue;   // Invalidated or re-buffered since
+        }
+        if (!it->second.used) {
+            prefetch_stats_.unused++;
+        }
+        ready_.erase(it);
+    }
+
+    // Keep the order queue bounded when lines are invalidated repeatedly
+    while (!ready_order_.empty()) {
+        auto it = ready_.find(ready_order_.front().first);
+        if (it != ready_.end() && it->second.stamp == ready_order_.front().second) {
+            break;
+        }
+        ready_order_.pop_front();
+    }
+}
+
+void PrefetchController::invalidate(Address line) {
+    if (auto it = ready_.find(line); it != ready_.end()) {
+        if (!it->second.used) {
+            prefetch_stats_.unused++;
+        }
+        ready_.erase(it);
+    }
+    if (auto entry = inflight_.find(line)) {
+        inflight_stale_[*entry] = 1;
+    }
+}
+
+} // namespace sw::memsim
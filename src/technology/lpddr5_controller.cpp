@@ -1,5 +1,10 @@
 #include <sw/memsim/technology/lpddr5/lpddr5_controller.hpp>
 
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <stdexcept>
+
 namespace sw::memsim::lpddr5 {
 
 // ============================================================================
@@ -88,112 +93,376 @@ LPDDR5Timing LPDDR5Timing::from_speed(uint32_t speed_mt_s) {
 // Cycle-Accurate Controller Implementation
 // ============================================================================
 
-CycleAccurateLPDDR5Controller::CycleAccurateLPDDR5Controller(const ControllerConfig& config)
+template <typename Scheduler>
+CycleAccurateLPDDR5Controller<Scheduler>::CycleAccurateLPDDR5Controller(const ControllerConfig& config)
     : config_(config)
-    , banks_(config.organization.num_channels * config.organization.banks_per_rank())
+    , banks_(config.organization.total_banks())
+    , channels_(config.organization.num_channels)
+    , ranks_(config.organization.num_channels * config.organization.ranks_per_channel)
+    , requests_(config.queue_depth)
+    , parent_of_(config.queue_depth, kNoParent)
+    , splits_(config.queue_depth)
+    , burst_bytes_(config.organization.burst_bytes())
+    , write_buffer_(config.write_buffer.entries, config.organization.burst_bytes())
 {
+    // Request::bank holds the bank within a rank
+    if (config.organization.banks_per_rank() > std::numeric_limits<Bank>::max() + 1u) {
+        throw std::invalid_argument("organization has more banks per rank than Bank can address");
+    }
+    if (config.scheduler != Scheduler::kPolicy) {
+        throw std::invalid_argument("config.scheduler does not match the controller's scheduler");
+    }
+
     // Initialize scheduler
-    SchedulerConfig sched_config;
-    sched_config.policy = SchedulerPolicy::FR_FCFS;
-    sched_config.buffer_size = config.queue_depth;
-    sched_config.num_banks = static_cast<uint8_t>(banks_.size());
+    sched_config_.policy = Scheduler::kPolicy;
+    sched_config_.buffer_size = config.queue_depth;
+    sched_config_.max_row_hit_streak = config.max_row_hit_streak;
+    sched_config_.max_request_age = config.max_request_age;
+    sched_config_.num_banks = config.organization.total_banks();
 
-    scheduler_ = std::make_unique<FrFcfsScheduler>(sched_config);
+    scheduler_ = std::make_unique<Scheduler>(sched_config_);
 
     // Initialize refresh manager
     RefreshConfig ref_config;
     ref_config.policy = RefreshPolicy::PER_BANK;
     ref_config.tREFI = config.timing.tREFI;
     ref_config.tRFCpb = config.timing.tRFCpb;
-    ref_config.num_banks = static_cast<uint8_t>(banks_.size());
+    ref_config.num_banks = config.organization.total_banks();
 
     // refresh_ = create_refresh_manager(ref_config);  // TODO: implement
+
+    reset_refresh();
 }
 
-std::optional<RequestId> CycleAccurateLPDDR5Controller::submit(Request request) {
-    if (!scheduler_->has_space()) {
+template <typename Scheduler>
+std::optional<RequestId> CycleAccurateLPDDR5Controller<Scheduler>::submit(Request request) {
+    request.id = next_id_;
+    request.submit_cycle = current_cycle_;
+
+    // Requests spanning several bursts are split into column accesses
+    if (request.size > 0 &&
+        burst_base(request.address) != burst_base(request.address + request.size - 1)) {
+        return submit_split(std::move(request));
+    }
+
+    RequestId id = request.id;
+    switch (admit(request, kNoParent)) {
+        case Admission::REJECTED:
+            return std::nullopt;
+        case Admission::COMPLETED:
+            // Posted write or forwarded read: no DRAM access outstanding
+            stats_.record_posted(request.type);
+            if (request.callback) {
+                request.callback(0);
+            }
+            break;
+        case Admission::QUEUED:
+            break;
+    }
+
+    next_id_++;
+    return id;
+}
+
+template <typename Scheduler>
+auto CycleAccurateLPDDR5Controller<Scheduler>::admit(
+    Request& request, uint32_t parent) -> Admission
+{
+    if (write_buffer_.enabled()) {
+        if (request.type == RequestType::WRITE) {
+            if (!write_buffer_.contains(request.address) && write_buffer_.full()) {
+                return Admission::REJECTED;
+            }
+
+            // The buffered copy carries no callback: it is acknowledged now
+            Request entry;
+            entry.id = request.id;
+            entry.address = request.address;
+            entry.size = request.size;
+            entry.type = request.type;
+            entry.priority = request.priority;
+            entry.submit_cycle = request.submit_cycle;
+            if (write_buffer_.post(std::move(entry)) == WriteBuffer::PostResult::MERGED) {
+                stats_.write_merges++;
+            }
+            return Admission::COMPLETED;
+        }
+        if (write_buffer_.contains(request.address)) {
+            // Read-after-write: forward buffered data, no DRAM access
+            stats_.read_forwards++;
+            return Admission::COMPLETED;
+        }
+    }
+
+    if (!scheduler_->has_space() || requests_.full()) {
+        return Admission::REJECTED;
+    }
+
+    // The scheduler buffers pointers, so the request must live in the pool
+    Request* pooled = requests_.acquire(std::move(request));
+    decode_address(*pooled);
+    parent_of_[requests_.index_of(pooled)] = parent;
+    if (parent != kNoParent) {
+        queued_children_++;
+    }
+    scheduler_->store(*pooled);
+    return Admission::QUEUED;
+}
+
+template <typename Scheduler>
+std::optional<RequestId> CycleAccurateLPDDR5Controller<Scheduler>::submit_split(Request request) {
+    if (splits_.full()) {
         return std::nullopt;
     }
 
-    request.id = next_id_++;
-    request.submit_cycle = current_cycle_;
-    decode_address(request);
+    SplitRequest split;
+    split.next = burst_base(request.address);
+    split.end = request.address + request.size;
+    split.parent = std::move(request);
+
+    SplitRequest* pooled = splits_.acquire(std::move(split));
+    splitting_.push_back(static_cast<uint32_t>(splits_.index_of(pooled)));
+    RequestId id = next_id_++;
+
+    // Start issuing children right away when there is room
+    feed_split_requests();
+    return id;
+}
+
+template <typename Scheduler>
+void CycleAccurateLPDDR5Controller<Scheduler>::feed_split_requests() {
+    while (!splitting_.empty()) {
+        uint32_t idx = splitting_.front();
+        SplitRequest& split = *splits_.at(idx);
+
+        while (split.next < split.end) {
+            Request child;
+            child.id = next_id_;
+            child.address = split.next;
+            child.size = burst_bytes_;
+            child.type = split.parent.type;
+            child.priority = split.parent.priority;
+            child.submit_cycle = split.parent.submit_cycle;
+
+            Admission result = admit(child, idx);
+            if (result == Admission::REJECTED) {
+                return;  // Retry next cycle, preserving order
+            }
+            next_id_++;
+            split.next += burst_bytes_;
+            if (result == Admission::QUEUED) {
+                split.outstanding++;
+                split.dram_access = true;
+            }
+        }
+
+        splitting_.pop_front();
+        if (split.outstanding == 0) {
+            complete_split(idx);
+        }
+    }
+}
+
+template <typename Scheduler>
+void CycleAccurateLPDDR5Controller<Scheduler>::complete_child(uint32_t parent) {
+    SplitRequest& split = *splits_.at(parent);
+    split.outstanding--;
+    if (split.outstanding == 0 && split.next >= split.end) {
+        complete_split(parent);
+    }
+}
 
-    scheduler_->store(request);
-    return request.id;
+template <typename Scheduler>
+void CycleAccurateLPDDR5Controller<Scheduler>::complete_split(uint32_t parent) {
+    SplitRequest* split = splits_.at(parent);
+    Request& request = split->parent;
+
+    // Fully posted/forwarded splits never touched DRAM
+    Cycle latency = split->dram_access
+        ? current_cycle_ - request.submit_cycle + config_.timing.tBurst
+        : current_cycle_ - request.submit_cycle;
+    if (latency > 0) {
+        stats_.record_completion(request.type, latency);
+    } else {
+        stats_.record_posted(request.type);
+    }
+    if (request.callback) {
+        request.callback(latency);
+    }
+    splits_.release(split);
 }
 
-bool CycleAccurateLPDDR5Controller::can_accept() const {
-    return scheduler_->has_space();
+template <typename Scheduler>
+void CycleAccurateLPDDR5Controller<Scheduler>::drain_write_buffer() {
+    if (write_buffer_.empty()) {
+        return;
+    }
+
+    const auto& params = config_.write_buffer;
+    if (write_buffer_.full() || write_buffer_.size() >= params.high_watermark) {
+        draining_writes_ = true;
+    }
+
+    // Forced drain down to the low watermark; otherwise trickle one write
+    // per cycle while no other requests are waiting
+    bool idle = !scheduler_->has_any_pending();
+    while (!write_buffer_.empty() && scheduler_->has_space() && !requests_.full()) {
+        if (draining_writes_ && write_buffer_.size() <= params.low_watermark) {
+            draining_writes_ = false;
+        }
+        if (!draining_writes_ && !idle) {
+            break;
+        }
+
+        Request* write = requests_.acquire(write_buffer_.pop_oldest());
+        write->posted = true;
+        decode_address(*write);
+        parent_of_[requests_.index_of(write)] = kNoParent;
+        scheduler_->store(*write);
+
+        if (!draining_writes_) {
+            break;
+        }
+    }
+}
+
+template <typename Scheduler>
+bool CycleAccurateLPDDR5Controller<Scheduler>::can_accept() const {
+    // Conservative: true only if a request of any type and size would be
+    // admitted
+    if (write_buffer_.enabled() && write_buffer_.full()) {
+        return false;
+    }
+    return scheduler_->has_space() && !requests_.full() && !splits_.full();
 }
 
-bool CycleAccurateLPDDR5Controller::has_pending() const {
-    return scheduler_->has_any_pending();
+template <typename Scheduler>
+bool CycleAccurateLPDDR5Controller<Scheduler>::has_pending() const {
+    return scheduler_->has_any_pending() || !write_buffer_.empty() || !splits_.empty();
 }
 
-size_t CycleAccurateLPDDR5Controller::pending_count() const {
-    return scheduler_->occupancy();
+template <typename Scheduler>
+size_t CycleAccurateLPDDR5Controller<Scheduler>::pending_count() const {
+    // A split request counts once, as its parent, like submit() returns it
+    return scheduler_->occupancy() - queued_children_ + write_buffer_.size() + splits_.in_use();
 }
 
-void CycleAccurateLPDDR5Controller::tick() {
+template <typename Scheduler>
+void CycleAccurateLPDDR5Controller<Scheduler>::tick() {
     current_cycle_++;
+    scheduler_->set_cycle(current_cycle_);
 
     // 1. Update bank state machines
     update_bank_states();
 
-    // 2. Issue new commands
+    // 2. Split large requests and move buffered writes into the scheduler
+    feed_split_requests();
+    drain_write_buffer();
+
+    // 3. Issue new commands
     issue_commands();
 
-    // 3. Complete transfers
+    // 4. Complete transfers
     complete_transfers();
 
-    // 4. Check invariants
+    // 5. Check invariants
     if (check_invariants_) {
         check_timing_invariants();
     }
 }
 
-void CycleAccurateLPDDR5Controller::drain() {
-    while (scheduler_->has_any_pending()) {
+template <typename Scheduler>
+void CycleAccurateLPDDR5Controller<Scheduler>::drain() {
+    while (has_pending()) {
         tick();
     }
 }
 
-void CycleAccurateLPDDR5Controller::reset() {
+template <typename Scheduler>
+void CycleAccurateLPDDR5Controller<Scheduler>::reset() {
     current_cycle_ = 0;
     next_id_ = 1;
-    for (auto& bank : banks_) {
-        bank = LPDDR5Bank{};
+    banks_.reset();
+    for (auto& channel : channels_) {
+        channel = LPDDR5Channel{};
     }
+    reset_refresh();
+    scheduler_ = std::make_unique<Scheduler>(sched_config_);
+    requests_.clear();
+    std::fill(parent_of_.begin(), parent_of_.end(), kNoParent);
+    queued_children_ = 0;
+    splits_.clear();
+    splitting_.clear();
+    write_buffer_.clear();
+    draining_writes_ = false;
     stats_.reset();
     violations_.clear();
 }
 
-BankState CycleAccurateLPDDR5Controller::bank_state(Channel channel, Bank bank) const {
-    size_t idx = channel * config_.organization.banks_per_rank() + bank;
+template <typename Scheduler>
+size_t CycleAccurateLPDDR5Controller<Scheduler>::channel_bank(Channel channel, uint32_t bank) const {
+    const auto& org = config_.organization;
+    if (channel >= org.num_channels || bank >= org.banks_per_channel()) {
+        return banks_.size();
+    }
+    return static_cast<size_t>(channel) * org.banks_per_channel() + bank;
+}
+
+template <typename Scheduler>
+BankState CycleAccurateLPDDR5Controller<Scheduler>::bank_state(Channel channel, uint32_t bank) const {
+    const size_t idx = channel_bank(channel, bank);
     if (idx < banks_.size()) {
-        return banks_[idx].state;
+        return banks_.state_of(idx);
     }
     return BankState::IDLE;
 }
 
-bool CycleAccurateLPDDR5Controller::is_row_open(Channel channel, Bank bank, Row row) const {
-    size_t idx = channel * config_.organization.banks_per_rank() + bank;
+template <typename Scheduler>
+bool CycleAccurateLPDDR5Controller<Scheduler>::is_row_open(Channel channel, uint32_t bank, Row row) const {
+    const size_t idx = channel_bank(channel, bank);
     if (idx < banks_.size()) {
-        return banks_[idx].state == BankState::ACTIVE && banks_[idx].open_row == row;
+        return banks_.state_of(idx) == BankState::ACTIVE && banks_.open_row[idx] == row;
     }
     return false;
 }
 
-std::optional<Row> CycleAccurateLPDDR5Controller::open_row(Channel channel, Bank bank) const {
-    size_t idx = channel * config_.organization.banks_per_rank() + bank;
-    if (idx < banks_.size() && banks_[idx].state == BankState::ACTIVE) {
-        return banks_[idx].open_row;
+template <typename Scheduler>
+std::optional<Row> CycleAccurateLPDDR5Controller<Scheduler>::open_row(Channel channel, uint32_t bank) const {
+    const size_t idx = channel_bank(channel, bank);
+    if (idx < banks_.size() && banks_.state_of(idx) == BankState::ACTIVE) {
+        return banks_.open_row[idx];
     }
     return std::nullopt;
 }
 
-void CycleAccurateLPDDR5Controller::decode_address(Request& request) {
+template <typename Scheduler>
+void CycleAccurateLPDDR5Controller<Scheduler>::warm(Request request) {
+    decode_address(request);
+    size_t idx = request.bank_index;
+    if (idx >= banks_.size()) {
+        return;
+    }
+
+    auto& b = banks_;
+    b.auto_precharge[idx] = 0;
+    b.row_conflict[idx] = 0;
+    if (config_.page_policy == PagePolicy::CLOSED) {
+        // Every access closes its row
+        b.set_state(idx, BankState::IDLE);
+        b.open_row[idx] = 0;
+        b.column_accesses[idx] = 0;
+        return;
+    }
+    if (b.state_of(idx) != BankState::ACTIVE || b.open_row[idx] != request.row) {
+        b.set_state(idx, BankState::ACTIVE);
+        b.open_row[idx] = request.row;
+        b.column_accesses[idx] = 0;
+    }
+    b.column_accesses[idx]++;
+}
+
+template <typename Scheduler>
+void CycleAccurateLPDDR5Controller<Scheduler>::decode_address(Request& request) const {
     // Simple address decoding (row:bank:column)
     const auto& org = config_.organization;
     uint64_t addr = request.address;
@@ -204,7 +473,12 @@ void CycleAccurateLPDDR5Controller::decode_address(Request& request) {
 
     // Extract bank bits
     request.bank = static_cast<Bank>(addr & (org.banks_per_rank() - 1));
-    addr >>= 4;
+    addr >>= std::bit_width(org.banks_per_rank() - 1);
+
+    // Extract rank bits
+    const unsigned ranks = org.ranks_per_channel;
+    request.rank = static_cast<Rank>(addr & (ranks - 1));
+    addr >>= std::bit_width(ranks - 1);
 
     // Extract row bits
     request.row = static_cast<Row>(addr & ((1 << 16) - 1));
@@ -212,108 +486,443 @@ void CycleAccurateLPDDR5Controller::decode_address(Request& request) {
 
     // Extract channel
     request.channel = static_cast<Channel>(addr & (org.num_channels - 1));
+
+    request.bank_index = org.flat_bank(request.channel, request.rank, request.bank);
 }
 
-void CycleAccurateLPDDR5Controller::update_bank_states() {
-    for (auto& bank : banks_) {
-        if (current_cycle_ >= bank.state_until) {
-            switch (bank.state) {
-                case BankState::ACTIVATING:
-                    bank.state = BankState::ACTIVE;
-                    break;
-                case BankState::PRECHARGING:
-                    bank.state = BankState::IDLE;
-                    bank.open_row = 0;
-                    break;
-                case BankState::READING:
-                case BankState::WRITING:
-                    bank.state = BankState::ACTIVE;
-                    break;
-                case BankState::REFRESHING:
-                    bank.state = BankState::IDLE;
-                    break;
-                default:
-                    break;
-            }
+template <typename Scheduler>
+void CycleAccurateLPDDR5Controller<Scheduler>::update_bank_states() {
+    banks_.update(current_cycle_);
+}
+
+template <typename Scheduler>
+void CycleAccurateLPDDR5Controller<Scheduler>::issue_commands() {
+    // Channels run in parallel; each issues at most one command per cycle,
+    // round-robin across its banks
+    const bool multi_rank = config_.organization.ranks_per_channel > 1;
+    for (size_t c = 0; c < channels_.size(); ++c) {
+        auto& channel = channels_[c];
+        if (current_cycle_ < channel.next_command) continue;
+
+        if (config_.enable_refresh && refresh_ranks(c)) {
+            channel.next_command = current_cycle_ + 1;
+            continue;
         }
+
+        // With several ranks, column accesses stay on the rank holding the
+        // data bus while it has row hits, up to max_rank_batch of them;
+        // then the other ranks' row hits go first
+        RankFilter filter = RankFilter::ANY;
+        if (multi_rank && config_.max_rank_batch > 0) {
+            filter = channel.rank_batch < config_.max_rank_batch ? RankFilter::SAME : RankFilter::OTHER;
+        }
+        scan_banks(channel, c, filter);
     }
 }
 
-void CycleAccurateLPDDR5Controller::issue_commands() {
-    // Simple round-robin across banks
-    for (size_t i = 0; i < banks_.size(); ++i) {
-        auto& bank = banks_[i];
-        auto bank_idx = static_cast<Bank>(i);
+template <typename Scheduler>
+bool CycleAccurateLPDDR5Controller<Scheduler>::scan_banks(
+    LPDDR5Channel& channel, size_t channel_idx, RankFilter filter)
+{
+    const uint32_t per_channel = config_.organization.banks_per_channel();
+    const BankIndex first = static_cast<BankIndex>(channel_idx * per_channel);
+    ScanResult scan;
+    for (uint32_t n = 0; n < per_channel; ++n) {
+        uint32_t offset = channel.next_bank + n;
+        if (offset >= per_channel) offset -= per_channel;
+
+        if (issue_command(channel, first + offset, filter, scan)) {
+            channel.next_command = current_cycle_ + 1;
+            channel.next_bank = offset + 1 < per_channel ? offset + 1 : 0;
+            return true;
+        }
+    }
 
-        std::optional<Row> row_opt = (bank.state == BankState::ACTIVE)
-            ? std::optional<Row>(bank.open_row)
-            : std::nullopt;
+    // The preferred ranks have no row hit at all: take the first ready one
+    // of another rank, as an unfiltered scan would have
+    if (!scan.rank_hit && scan.fallback_request != nullptr) {
+        issue_row_hit(channel, scan.fallback, *scan.fallback_request);
+        channel.next_command = current_cycle_ + 1;
+        const uint32_t offset = scan.fallback - first;
+        channel.next_bank = offset + 1 < per_channel ? offset + 1 : 0;
+        return true;
+    }
+    return false;
+}
 
-        Request* req = scheduler_->get_next(bank_idx, row_opt, last_command_);
-        if (!req) continue;
+template <typename Scheduler>
+void CycleAccurateLPDDR5Controller<Scheduler>::issue_row_hit(
+    LPDDR5Channel& channel, BankIndex bank_idx, Request& request)
+{
+    bool close = should_auto_precharge(bank_idx, request);
+    Command cmd = (request.type == RequestType::READ)
+        ? (close ? Command::RDA : Command::RD)
+        : (close ? Command::WRA : Command::WR);
+    issue_column(bank_idx, channel, request, cmd);
+}
 
-        // Check if we can issue the command
-        if (bank.state == BankState::IDLE) {
-            // Need to activate
-            if (current_cycle_ >= bank.next_act) {
-                bank.state = BankState::ACTIVATING;
-                bank.open_row = req->row;
-                bank.state_until = current_cycle_ + config_.timing.tRCD;
-                bank.next_act = current_cycle_ + config_.timing.tRC;
-                bank.next_rd = current_cycle_ + config_.timing.tRCD;
-                bank.next_wr = current_cycle_ + config_.timing.tRCD;
-            }
-        } else if (bank.state == BankState::ACTIVE) {
-            if (bank.open_row == req->row) {
-                // Row hit
-                if (bank.is_ready_for(req->type, current_cycle_)) {
-                    stats_.page_hits++;
-
-                    if (req->type == RequestType::READ) {
-                        bank.state = BankState::READING;
-                        bank.state_until = current_cycle_ + config_.timing.tBurst;
-                        bank.next_rd = current_cycle_ + config_.timing.tCCD_S;
-                        bank.next_wr = current_cycle_ + config_.timing.tRTW;
-                        last_read_cycle_ = current_cycle_;
-                    } else {
-                        bank.state = BankState::WRITING;
-                        bank.state_until = current_cycle_ + config_.timing.tBurst;
-                        bank.next_wr = current_cycle_ + config_.timing.tCCD_S;
-                        bank.next_rd = current_cycle_ + config_.timing.tWTR_S;
-                        last_write_cycle_ = current_cycle_;
-                    }
-
-                    last_command_ = req->type;
-
-                    // Record completion
-                    Cycle latency = current_cycle_ - req->submit_cycle + config_.timing.tBurst;
-                    stats_.record_request(req->type, latency, true, false);
-
-                    if (req->callback) {
-                        req->callback(latency);
-                    }
-
-                    scheduler_->remove(*req);
-                }
-            } else {
-                // Row conflict - need to precharge first
-                stats_.page_conflicts++;
-                if (current_cycle_ >= bank.next_pre) {
-                    bank.state = BankState::PRECHARGING;
-                    bank.state_until = current_cycle_ + config_.timing.tRP;
-                    bank.next_act = current_cycle_ + config_.timing.tRP;
+template <typename Scheduler>
+bool CycleAccurateLPDDR5Controller<Scheduler>::issue_command(
+    LPDDR5Channel& channel, BankIndex bank_idx, RankFilter filter, ScanResult& scan)
+{
+    auto& b = banks_;
+    if (config_.enable_refresh && ranks_[bank_idx / config_.organization.banks_per_rank()].refresh_due) {
+        return false;
+    }
+
+    const BankState state = b.state_of(bank_idx);
+    std::optional<Row> row_opt = (state == BankState::ACTIVE)
+        ? std::optional<Row>(b.open_row[bank_idx])
+        : std::nullopt;
+
+    Request* req = scheduler_->get_next(bank_idx, row_opt, channel.last_column);
+    if (!req) return false;
+
+    // Check if we can issue the command
+    if (state == BankState::IDLE) {
+        // Need to activate
+        if (current_cycle_ >= b.next_act[bank_idx]) {
+            activate(bank_idx, req->row);
+            return true;
+        }
+    } else if (state == BankState::ACTIVE) {
+        if (b.open_row[bank_idx] == req->row) {
+            // Row hit: the bank and the channel's data bus must both be free
+            const bool same_rank = req->rank == channel.last_rank;
+            const bool ready = b.is_ready_for(bank_idx, req->type, current_cycle_) &&
+                               channel.is_ready_for(req->type, req->rank, current_cycle_);
+            if ((filter == RankFilter::SAME && !same_rank) ||
+                (filter == RankFilter::OTHER && same_rank)) {
+                if (ready && scan.fallback_request == nullptr) {
+                    scan.fallback = bank_idx;
+                    scan.fallback_request = req;
                 }
+                return false;
+            }
+            scan.rank_hit = true;
+            if (ready) {
+                issue_row_hit(channel, bank_idx, *req);
+                return true;
+            }
+        } else {
+            // Row conflict - need to precharge first
+            if (current_cycle_ >= b.next_pre[bank_idx]) {
+                b.row_conflict[bank_idx] = 1;
+                precharge(bank_idx);
+                return true;
             }
         }
     }
+    return false;
 }
 
-void CycleAccurateLPDDR5Controller::complete_transfers() {
+template <typename Scheduler>
+bool CycleAccurateLPDDR5Controller<Scheduler>::refresh_ranks(size_t channel_idx) {
+    const auto& org = config_.organization;
+    const auto& t = config_.timing;
+    const uint32_t per_rank = org.banks_per_rank();
+
+    for (Rank r = 0; r < org.ranks_per_channel; ++r) {
+        const BankIndex first = org.flat_bank(static_cast<Channel>(channel_idx), r, 0);
+        auto& rank = ranks_[first / per_rank];
+        if (!rank.refresh_due) {
+            if (current_cycle_ < rank.next_refresh) continue;
+            rank.refresh_due = true;
+        }
+
+        // Close open rows first, one PRE per cycle
+        bool ready = true;
+        for (BankIndex i = first; i < first + per_rank; ++i) {
+            if (banks_.state_of(i) == BankState::ACTIVE && current_cycle_ >= banks_.next_pre[i]) {
+                precharge(i);
+                return true;
+            }
+            ready = ready && banks_.state_of(i) == BankState::IDLE && current_cycle_ >= banks_.next_act[i];
+        }
+        if (!ready) continue;
+
+        // REF: every bank of the rank is busy for tRFC
+        for (BankIndex i = first; i < first + per_rank; ++i) {
+            banks_.enter(i, BankState::REFRESHING, current_cycle_ + t.tRFC);
+            banks_.next_act[i] = current_cycle_ + t.tRFC;
+        }
+        rank.refresh_due = false;
+        rank.next_refresh += t.tREFI;
+        stats_.refreshes++;
+        stats_.refresh_cycles += t.tRFC;
+        return true;
+    }
+    return false;
+}
+
+template <typename Scheduler>
+void CycleAccurateLPDDR5Controller<Scheduler>::reset_refresh() {
+    // Stagger the ranks of a channel across the refresh interval
+    const auto& org = config_.organization;
+    const Cycle interval = config_.timing.tREFI;
+    for (size_t i = 0; i < ranks_.size(); ++i) {
+        const Cycle r = i % org.ranks_per_channel;
+        ranks_[i] = LPDDR5Rank{};
+        ranks_[i].next_refresh = interval + r * interval / org.ranks_per_channel;
+    }
+}
+
+template <typename Scheduler>
+void CycleAccurateLPDDR5Controller<Scheduler>::activate(BankIndex bank, Row row) {
+    const auto& t = config_.timing;
+    auto& b = banks_;
+    b.enter(bank, BankState::ACTIVATING, current_cycle_ + t.tRCD);
+    b.open_row[bank] = row;
+    b.column_accesses[bank] = 0;
+    b.next_act[bank] = current_cycle_ + t.tRC;
+    b.next_rd[bank] = current_cycle_ + t.tRCD;
+    b.next_wr[bank] = current_cycle_ + t.tRCD;
+    b.next_pre[bank] = current_cycle_ + t.tRAS;
+    stats_.activates++;
+}
+
+template <typename Scheduler>
+void CycleAccurateLPDDR5Controller<Scheduler>::precharge(BankIndex bank) {
+    const auto& t = config_.timing;
+    banks_.enter(bank, BankState::PRECHARGING, current_cycle_ + t.tRP);
+    banks_.next_act[bank] = std::max(banks_.next_act[bank], current_cycle_ + t.tRP);
+    stats_.precharges++;
+}
+
+template <typename Scheduler>
+void CycleAccurateLPDDR5Controller<Scheduler>::issue_column(
+    BankIndex bank, LPDDR5Channel& channel, Request& request, Command command)
+{
+    const auto& t = config_.timing;
+    auto& b = banks_;
+
+    // Classify the access against the row buffer: the first access after an
+    // ACT is a miss (empty, or conflict if a different row had to be closed)
+    bool page_hit = b.column_accesses[bank] > 0;
+    bool page_conflict = !page_hit && b.row_conflict[bank];
+    b.row_conflict[bank] = 0;
+    b.column_accesses[bank]++;
+
+    if (request.type == RequestType::READ) {
+        b.enter(bank, BankState::READING, current_cycle_ + t.tBurst);
+        b.next_rd[bank] = current_cycle_ + t.tCCD_S;
+        b.next_wr[bank] = current_cycle_ + t.tRTW;
+        b.next_pre[bank] = std::max(b.next_pre[bank], current_cycle_ + t.tRTP);
+
+        // The burst holds the data bus; a write must wait for the turnaround
+        channel.next_rd = current_cycle_ + std::max(t.tCCD_S, t.tBurst);
+        channel.next_wr = std::max(channel.next_wr, current_cycle_ + t.tRTW);
+    } else {
+        b.enter(bank, BankState::WRITING, current_cycle_ + t.tBurst);
+        b.next_wr[bank] = current_cycle_ + t.tCCD_S;
+        b.next_rd[bank] = current_cycle_ + t.tWTR_S;
+        b.next_pre[bank] = std::max(b.next_pre[bank], current_cycle_ + t.tWL + t.tBurst + t.tWR);
+
+        // A read must wait until the write data is in plus tWTR
+        channel.next_wr = current_cycle_ + std::max(t.tCCD_S, t.tBurst);
+        channel.next_rd = std::max(channel.next_rd, current_cycle_ + t.tWL + t.tBurst + t.tWTR_S);
+    }
+
+    if (command == Command::RDA || command == Command::WRA) {
+        // Internal precharge starts once tRAS/tRTP/tWR are satisfied
+        Cycle pre_start = std::max(b.state_until[bank], b.next_pre[bank]);
+        b.auto_precharge[bank] = 1;
+        b.precharge_until[bank] = pre_start + t.tRP;
+        b.next_act[bank] = std::max(b.next_act[bank], b.precharge_until[bank]);
+        stats_.auto_precharges++;
+    }
+
+    channel.last_column = request.type;
+    channel.next_rank_switch = current_cycle_ + t.tBurst + t.tRTRS;
+    if (request.rank == channel.last_rank) {
+        channel.rank_batch++;
+    } else {
+        channel.last_rank = request.rank;
+        channel.rank_batch = 1;
+        stats_.rank_switches++;
+    }
+
+    size_t slot = requests_.index_of(&request);
+    uint32_t parent = parent_of_[slot];
+
+    if (request.posted || parent != kNoParent) {
+        // Drained buffered write (acknowledged at post time) or a child of a
+        // split request (completed with its parent)
+        stats_.record_page_access(page_hit, page_conflict);
+    } else {
+        // Record completion
+        Cycle latency = current_cycle_ - request.submit_cycle + t.tBurst;
+        stats_.record_request(request.type, latency, page_hit, page_conflict);
+
+        if (request.callback) {
+            request.callback(latency);
+        }
+    }
+
+    scheduler_->remove(request);
+    requests_.release(&request);
+
+    if (parent != kNoParent) {
+        parent_of_[slot] = kNoParent;
+        queued_children_--;
+        complete_child(parent);
+    }
+}
+
+template <typename Scheduler>
+bool CycleAccurateLPDDR5Controller<Scheduler>::should_auto_precharge(
+    BankIndex bank, const Request& request) const
+{
+    switch (config_.page_policy) {
+        case PagePolicy::OPEN:
+            return false;
+        case PagePolicy::CLOSED:
+            return true;
+        case PagePolicy::OPEN_ADAPTIVE:
+            // Close only if nothing else wants this row but another row is waiting
+            return !scheduler_->has_row_hit(bank, request.row, request.type) &&
+                   scheduler_->has_pending(bank, request.type);
+        case PagePolicy::CLOSED_ADAPTIVE:
+            // Keep the row only while further hits are queued
+            return !scheduler_->has_row_hit(bank, request.row, request.type);
+        default:
+            return false;
+    }
+}
+
+template <typename Scheduler>
+void CycleAccurateLPDDR5Controller<Scheduler>::complete_transfers() {
     // Transfers complete via callbacks in issue_commands
 }
 
-void CycleAccurateLPDDR5Controller::check_timing_invariants() {
+template <typename Scheduler>
+void CycleAccurateLPDDR5Controller<Scheduler>::check_timing_invariants() {
     // TODO: Add timing invariant checks
 }
 
+// ============================================================================
+// Cloning and Checkpointing
+// ============================================================================
+
+template <typename Scheduler>
+std::unique_ptr<IMemoryController> CycleAccurateLPDDR5Controller<Scheduler>::clone() const {
+    auto copy = std::make_unique<CycleAccurateLPDDR5Controller<Scheduler>>(config_);
+    copy->current_cycle_ = current_cycle_;
+    copy->next_id_ = next_id_;
+    copy->banks_ = banks_;
+    copy->channels_ = channels_;
+    copy->ranks_ = ranks_;
+
+    // Pools copy slot for slot, so the scheduler's pointers remap by index
+    copy->requests_ = requests_;
+    copy->parent_of_ = parent_of_;
+    copy->queued_children_ = queued_children_;
+    copy->splits_ = splits_;
+    copy->splitting_ = splitting_;
+    Pool<Request>& pool = copy->requests_;
+    copy->scheduler_ = scheduler_->copy([this, &pool](const Request* r) {
+        return pool.at(requests_.index_of(r));
+    });
+
+    copy->write_buffer_ = write_buffer_;
+    copy->draining_writes_ = draining_writes_;
+
+    copy->stats_ = stats_;
+    copy->tracing_ = tracing_;
+    copy->check_invariants_ = check_invariants_;
+    copy->violations_ = violations_;
+    return copy;
+}
+
+template <typename Scheduler>
+void CycleAccurateLPDDR5Controller<Scheduler>::save_state(CheckpointWriter& out) const {
+    out.write(current_cycle_);
+    out.write(next_id_);
+    out.write(burst_bytes_);
+
+    // Bank state machines (refresh in progress is a bank state) and buses
+    banks_.save(out);
+    out.write_vector(channels_);
+    out.write_vector(ranks_);
+
+    // Queued accesses, their split parents and the scheduler's view of them
+    requests_.save(out, [](CheckpointWriter& w, const Request& r) { w.write_request(r); });
+    out.write_vector(parent_of_);
+    splits_.save(out, save_split);
+    out.write<uint64_t>(splitting_.size());
+    for (uint32_t idx : splitting_) {
+        out.write(idx);
+    }
+    scheduler_->save_state(out, [this](const Request* r) {
+        return static_cast<uint32_t>(requests_.index_of(r));
+    });
+
+    write_buffer_.save(out);
+    out.write(draining_writes_);
+
+    out.write(stats_);
+}
+
+template <typename Scheduler>
+void CycleAccurateLPDDR5Controller<Scheduler>::restore_state(CheckpointReader& in) {
+    reset();
+
+    current_cycle_ = in.read<Cycle>();
+    next_id_ = in.read<RequestId>();
+    in.expect(burst_bytes_, "burst size");
+
+    banks_.restore(in);
+    in.read_vector_into(channels_);
+    in.read_vector_into(ranks_);
+
+    requests_.restore(in, [](CheckpointReader& r) { return r.read_request(); });
+    in.read_vector_into(parent_of_);
+    splits_.restore(in, load_split);
+    auto splitting = in.read<uint64_t>();
+    for (uint64_t i = 0; i < splitting; ++i) {
+        auto idx = in.read<uint32_t>();
+        (void)splits_.checked_at(idx);
+        splitting_.push_back(idx);
+    }
+    for (uint32_t parent : parent_of_) {
+        if (parent != kNoParent) {
+            (void)splits_.checked_at(parent);
+            queued_children_++;
+        }
+    }
+    scheduler_->restore_state(in, [this](uint32_t idx) { return requests_.checked_at(idx); });
+    scheduler_->set_cycle(current_cycle_);
+
+    write_buffer_.restore(in);
+    draining_writes_ = in.read<bool>();
+
+    stats_ = in.read<Statistics>();
+}
+
+template <typename Scheduler>
+void CycleAccurateLPDDR5Controller<Scheduler>::save_split(CheckpointWriter& out, const SplitRequest& split) {
+    out.write_request(split.parent);
+    out.write(split.next);
+    out.write(split.end);
+    out.write(split.outstanding);
+    out.write(split.dram_access);
+}
+
+template <typename Scheduler>
+auto CycleAccurateLPDDR5Controller<Scheduler>::load_split(
+    CheckpointReader& in) -> SplitRequest
+{
+    SplitRequest split;
+    split.parent = in.read_request();
+    split.next = in.read<Address>();
+    split.end = in.read<Address>();
+    split.outstanding = in.read<uint32_t>();
+    split.dram_access = in.read<bool>();
+    return split;
+}
+
+template class CycleAccurateLPDDR5Controller<FifoScheduler>;
+template class CycleAccurateLPDDR5Controller<FrFcfsScheduler>;
+template class CycleAccurateLPDDR5Controller<FrFcfsGrpScheduler>;
+
 } // namespace sw::memsim::lpddr5
@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+#include <sw/memsim/memsim.hpp>
+#include <sw/memsim/technology/lpddr5/lpddr5_controller.hpp>
+
+#include "bench_traffic.hpp"
+
+using namespace sw::memsim;
+using bench::Pattern;
+using bench::Traffic;
+
+namespace {
+
+ControllerConfig bench_config(Fidelity fidelity) {
+    ControllerConfig config;
+    config.technology = Technology::LPDDR5;
+    config.fidelity = fidelity;
+    config.timing = timing_presets::lpddr5_6400();
+    return config;
+}
+
+} // namespace
+
+// ============================================================================
+// Submit Throughput
+// ============================================================================
+
+/// Requests accepted per second, ticking only when the queue back-pressures
+static void BM_Submit(benchmark::State& state, Fidelity fidelity) {
+    auto controller = lpddr5::create_lpddr5_controller(bench_config(fidelity));
+    Traffic traffic(Pattern::STREAMING);
+
+    for (auto _ : state) {
+        Request request = traffic.next();
+        while (!controller->submit(request)) {
+            controller->tick();
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK_CAPTURE(BM_Submit, behavioral, Fidelity::BEHAVIORAL);
+BENCHMARK_CAPTURE(BM_Submit, transactional, Fidelity::TRANSACTIONAL);
+BENCHMARK_CAPTURE(BM_Submit, cycle_accurate, Fidelity::CYCLE_ACCURATE);
+
+// ============================================================================
+// Address Decode
+// ============================================================================
+
+static void BM_AddressDecode(benchmark::State& state) {
+    lpddr5::CycleAccurateLPDDR5Controller controller(bench_config(Fidelity::CYCLE_ACCURATE));
+    Address address = 0;
+
+    for (auto _ : state) {
+        Request decoded = controller.decode(address);
+        benchmark::DoNotOptimize(decoded.row);
+        benchmark::DoNotOptimize(decoded.bank);
+        address += 0x9E3779B1;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_AddressDecode);
+
+// ============================================================================
+// Cycle-Accurate Tick Rate
+// ============================================================================
+
+/// Simulated cycles per second with the request queue kept full
+static void BM_CycleAccurateTicks(benchmark::State& state, Pattern pattern) {
+    lpddr5::CycleAccurateLPDDR5Controller controller(bench_config(Fidelity::CYCLE_ACCURATE));
+    Traffic traffic(pattern);
+    Request pending = traffic.next();
+
+    for (auto _ : state) {
+        while (controller.submit(pending)) {
+            pending = traffic.next();
+        }
+        controller.tick();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+    state.counters["requests/s"] = benchmark::Counter(
+        static_cast<double>(controller.stats().total_requests()), benchmark::Counter::kIsRate);
+}
+BENCHMARK_CAPTURE(BM_CycleAccurateTicks, streaming, Pattern::STREAMING);
+BENCHMARK_CAPTURE(BM_CycleAccurateTicks, random, Pattern::RANDOM);
+BENCHMARK_CAPTURE(BM_CycleAccurateTicks, mixed, Pattern::MIXED);
@@ -0,0 +1,105 @@
+#include <benchmark/benchmark.h>
+#include <sw/memsim/scheduler/fifo.hpp>
+#include <sw/memsim/scheduler/fr_fcfs.hpp>
+#include <sw/memsim/scheduler/fr_fcfs_grp.hpp>
+
+#include <optional>
+#include <vector>
+
+using namespace sw::memsim;
+
+namespace {
+
+constexpr uint8_t kBanks = 16;
+
+/// Scheduler sized to hold `depth` requests in a single bank
+template<typename Scheduler>
+Scheduler make_scheduler(SchedulerPolicy policy, int64_t depth) {
+    SchedulerConfig config;
+    config.policy = policy;
+    config.buffer_size = static_cast<uint32_t>(depth) + 1;
+    config.num_banks = kBanks;
+    return Scheduler(config);
+}
+
+/// Request for bank 0 whose row repeats every eight requests
+Request make_request(RequestId id) {
+    Request request;
+    request.id = id;
+    request.type = (id % 4 == 0) ? RequestType::WRITE : RequestType::READ;
+    request.bank = 0;
+    request.row = static_cast<Row>(id % 8);
+    request.column = static_cast<Column>(id % 64);
+    request.size = 32;
+    return request;
+}
+
+} // namespace
+
+// ============================================================================
+// Selection at Queue Depth
+// ============================================================================
+
+/// get_next() against a bank holding `depth` requests, the open row
+/// matching the newest one (worst-case scan for a row hit)
+template<typename Scheduler, SchedulerPolicy Policy>
+static void BM_GetNext(benchmark::State& state) {
+    const int64_t depth = state.range(0);
+    auto scheduler = make_scheduler<Scheduler>(Policy, depth);
+
+    std::vector<Request> requests;
+    requests.reserve(static_cast<size_t>(depth));
+    for (int64_t i = 0; i < depth; ++i) {
+        requests.push_back(make_request(static_cast<RequestId>(i)));
+        requests.back().row = (i + 1 == depth) ? 1000 : static_cast<Row>(i % 8);
+    }
+    for (auto& request : requests) {
+        scheduler.store(request);
+    }
+
+    for (auto _ : state) {
+        Request* next = scheduler.get_next(0, Row{1000}, RequestType::READ);
+        benchmark::DoNotOptimize(next);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+// ============================================================================
+// Store / Select / Remove Cycle
+// ============================================================================
+
+/// One request in, one request out, with the buffer held at `depth`
+template<typename Scheduler, SchedulerPolicy Policy>
+static void BM_StoreRemove(benchmark::State& state) {
+    const int64_t depth = state.range(0);
+    auto scheduler = make_scheduler<Scheduler>(Policy, depth);
+
+    // One spare slot: the request removed each iteration frees the next slot
+    std::vector<Request> slots(static_cast<size_t>(depth) + 1);
+    RequestId next_id = 0;
+    for (int64_t i = 0; i < depth; ++i) {
+        slots[static_cast<size_t>(i)] = make_request(next_id++);
+        scheduler.store(slots[static_cast<size_t>(i)]);
+    }
+
+    Request* free_slot = &slots.back();
+    std::optional<Row> open_row;
+    for (auto _ : state) {
+        *free_slot = make_request(next_id++);
+        scheduler.store(*free_slot);
+
+        Request* next = scheduler.get_next(0, open_row, RequestType::READ);
+        open_row = next->row;
+        scheduler.remove(*next);
+        free_slot = next;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+#define MEMSIM_SCHEDULER_BENCHMARKS(Scheduler, policy)                                \
+    BENCHMARK_TEMPLATE(BM_GetNext, Scheduler, policy)->RangeMultiplier(4)->Range(8, 512); \
+    BENCHMARK_TEMPLATE(BM_StoreRemove, Scheduler, policy)->RangeMultiplier(4)->Range(8, 512)
+
+MEMSIM_SCHEDULER_BENCHMARKS(FifoScheduler, SchedulerPolicy::FIFO);
+MEMSIM_SCHEDULER_BENCHMARKS(FrFcfsScheduler, SchedulerPolicy::FR_FCFS);
+MEMSIM_SCHEDULER_BENCHMARKS(FrFcfsGrpScheduler, SchedulerPolicy::FR_FCFS_GRP);
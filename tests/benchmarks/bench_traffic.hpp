@@ -0,0 +1,65 @@
+#pragma once
+
+#include <sw/memsim/core/types.hpp>
+
+#include <cstdint>
+#include <string_view>
+
+namespace sw::memsim::bench {
+
+/// Canonical traffic patterns shared by the benchmarks
+enum class Pattern { STREAMING, RANDOM, MIXED };
+
+/// Deterministic address stream (burst-sized accesses)
+class Traffic {
+public:
+    explicit Traffic(Pattern pattern) : pattern_(pattern) {}
+
+    Request next() {
+        Request request;
+        request.size = 32;
+        request.type = RequestType::READ;
+        switch (pattern_) {
+            case Pattern::STREAMING:
+                request.address = (n_++ * 32) & kSpan;
+                break;
+            case Pattern::RANDOM:
+                request.address = random() & kSpan & ~Address{31};
+                break;
+            case Pattern::MIXED:
+                // Row-local runs at random rows, one write in three
+                if (n_ % 8 == 0) {
+                    base_ = random() & kSpan & ~Address{1023};
+                }
+                request.address = base_ + (n_ % 8) * 32;
+                request.type = (n_ % 3 == 0) ? RequestType::WRITE : RequestType::READ;
+                n_++;
+                break;
+        }
+        return request;
+    }
+
+private:
+    static constexpr Address kSpan = (Address{1} << 30) - 1;
+
+    uint64_t random() {
+        state_ = state_ * 6364136223846793005ULL + 1442695040888963407ULL;
+        return state_ >> 16;
+    }
+
+    Pattern pattern_;
+    uint64_t n_ = 0;
+    uint64_t state_ = 1;
+    Address base_ = 0;
+};
+
+inline std::string_view to_string(Pattern pattern) {
+    switch (pattern) {
+        case Pattern::STREAMING: return "streaming";
+        case Pattern::RANDOM: return "random";
+        case Pattern::MIXED: return "mixed";
+    }
+    return "unknown";
+}
+
+} // namespace sw::memsim::bench
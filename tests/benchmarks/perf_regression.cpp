@@ -0,0 +1,274 @@
+// End-to-end simulator performance regression harness
+//
+// Runs the canonical workloads at every fidelity, reports simulated cycles
+// and requests per wall-clock second, and compares them (and the speedup of
+// each fidelity over cycle-accurate) against a stored baseline.
+//
+// Usage:
+//   memsim_perf_regression [--baseline FILE] [--write-baseline FILE]
+//                          [--tolerance FRACTION] [--requests N]
+//                          [--repetitions N] [--speedup-only]
+//
+// Exits with status 1 when any metric falls more than the tolerance below
+// its baseline. Throughput baselines are machine specific: regenerate them
+// with --write-baseline on the reference machine from a Release build.
+// --speedup-only compares just the fidelity speedups, which hold across
+// hosts far better than absolute throughput.
+
+#include <sw/memsim/memsim.hpp>
+#include <sw/memsim/technology/lpddr5/lpddr5_controller.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include "bench_traffic.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace sw::memsim;
+using bench::Pattern;
+using bench::Traffic;
+
+namespace {
+
+struct Options {
+    std::string baseline;
+    std::string write_baseline;
+    std::optional<double> tolerance;     ///< Defaults to the baseline's, else 25%
+    std::optional<uint64_t> requests;    ///< Defaults to the baseline's, else 200000
+    unsigned repetitions = 5;
+    bool speedup_only = false;           ///< Skip the absolute throughput checks
+};
+
+struct Measurement {
+    double seconds = 0.0;
+    Cycle cycles = 0;
+    uint64_t requests = 0;
+
+    double cycles_per_sec() const { return static_cast<double>(cycles) / seconds; }
+    double requests_per_sec() const { return static_cast<double>(requests) / seconds; }
+};
+
+constexpr Fidelity kFidelities[] = {
+    Fidelity::BEHAVIORAL, Fidelity::TRANSACTIONAL, Fidelity::CYCLE_ACCURATE
+};
+constexpr Pattern kPatterns[] = {Pattern::STREAMING, Pattern::RANDOM, Pattern::MIXED};
+
+std::string fidelity_key(Fidelity fidelity) {
+    switch (fidelity) {
+        case Fidelity::BEHAVIORAL: return "behavioral";
+        case Fidelity::TRANSACTIONAL: return "transactional";
+        case Fidelity::CYCLE_ACCURATE: return "cycle_accurate";
+    }
+    return "unknown";
+}
+
+std::string workload_key(Fidelity fidelity, Pattern pattern) {
+    return fidelity_key(fidelity) + "/" + std::string(bench::to_string(pattern));
+}
+
+/// Offer one request per cycle to the controller, then drain
+Measurement run_workload(Fidelity fidelity, Pattern pattern, uint64_t requests) {
+    ControllerConfig config;
+    config.technology = Technology::LPDDR5;
+    config.fidelity = fidelity;
+    config.timing = timing_presets::lpddr5_6400();
+    auto controller = lpddr5::create_lpddr5_controller(config);
+
+    Traffic traffic(pattern);
+    Request pending = traffic.next();
+    uint64_t submitted = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    while (submitted < requests) {
+        if (controller->submit(pending)) {
+            pending = traffic.next();
+            submitted++;
+        }
+        controller->tick();
+    }
+    controller->drain();
+    auto stop = std::chrono::steady_clock::now();
+
+    Measurement m;
+    m.seconds = std::max(std::chrono::duration<double>(stop - start).count(), 1e-9);
+    m.cycles = controller->cycle();
+    m.requests = submitted;
+    return m;
+}
+
+/// Best of several runs (least disturbed by the host)
+Measurement measure(Fidelity fidelity, Pattern pattern, const Options& options) {
+    Measurement best;
+    for (unsigned rep = 0; rep < options.repetitions; ++rep) {
+        Measurement m = run_workload(fidelity, pattern, *options.requests);
+        if (rep == 0 || m.seconds < best.seconds) {
+            best = m;
+        }
+    }
+    return best;
+}
+
+/// Geometric mean over workloads of requests/s relative to cycle-accurate
+double speedup(const std::map<std::string, Measurement>& results, Fidelity fidelity) {
+    double log_sum = 0.0;
+    for (Pattern pattern : kPatterns) {
+        log_sum += std::log(results.at(workload_key(fidelity, pattern)).requests_per_sec() /
+                            results.at(workload_key(Fidelity::CYCLE_ACCURATE, pattern)).requests_per_sec());
+    }
+    return std::exp(log_sum / static_cast<double>(std::size(kPatterns)));
+}
+
+nlohmann::json to_json(const std::map<std::string, Measurement>& results, const Options& options) {
+    nlohmann::json doc;
+    doc["tolerance"] = *options.tolerance;
+    doc["requests"] = *options.requests;
+    for (const auto& [key, m] : results) {
+        doc["results"][key] = {
+            {"cycles_per_sec", m.cycles_per_sec()},
+            {"requests_per_sec", m.requests_per_sec()}
+        };
+    }
+    for (Fidelity fidelity : {Fidelity::BEHAVIORAL, Fidelity::TRANSACTIONAL}) {
+        doc["speedup"][fidelity_key(fidelity)] = speedup(results, fidelity);
+    }
+    return doc;
+}
+
+/// Check one metric; returns false on regression
+bool check(const std::string& name, double measured, double baseline, double tolerance) {
+    double ratio = measured / baseline;
+    bool ok = ratio >= 1.0 - tolerance;
+    std::cout << "  " << std::left << std::setw(44) << name
+              << std::right << std::setw(8) << std::fixed << std::setprecision(2) << ratio << "x"
+              << (ok ? "" : "  REGRESSION") << "\n";
+    return ok;
+}
+
+bool compare(const std::map<std::string, Measurement>& results,
+             const nlohmann::json& baseline, double tolerance, bool speedup_only) {
+    bool ok = true;
+    std::cout << "\nAgainst baseline (tolerance " << tolerance * 100.0 << "%):\n";
+    for (const auto& [key, m] : results) {
+        if (speedup_only) {
+            break;
+        }
+        if (!baseline["results"].contains(key)) {
+            std::cout << "  " << key << ": no baseline\n";
+            continue;
+        }
+        const auto& base = baseline["results"][key];
+        ok &= check(key + " cycles/s", m.cycles_per_sec(), base["cycles_per_sec"].get<double>(), tolerance);
+        ok &= check(key + " requests/s", m.requests_per_sec(), base["requests_per_sec"].get<double>(), tolerance);
+    }
+    for (Fidelity fidelity : {Fidelity::BEHAVIORAL, Fidelity::TRANSACTIONAL}) {
+        std::string key = fidelity_key(fidelity);
+        if (baseline.contains("speedup") && baseline["speedup"].contains(key)) {
+            ok &= check(key + " speedup", speedup(results, fidelity),
+                        baseline["speedup"][key].get<double>(), tolerance);
+        }
+    }
+    return ok;
+}
+
+Options parse_options(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&]() -> std::string {
+            if (i + 1 >= argc) {
+                throw std::invalid_argument(arg + " requires a value");
+            }
+            return argv[++i];
+        };
+        if (arg == "--baseline") {
+            options.baseline = value();
+        } else if (arg == "--write-baseline") {
+            options.write_baseline = value();
+        } else if (arg == "--tolerance") {
+            options.tolerance = std::stod(value());
+        } else if (arg == "--requests") {
+            options.requests = std::stoull(value());
+        } else if (arg == "--repetitions") {
+            options.repetitions = static_cast<unsigned>(std::stoul(value()));
+        } else if (arg == "--speedup-only") {
+            options.speedup_only = true;
+        } else {
+            throw std::invalid_argument("unknown option " + arg);
+        }
+    }
+    if (options.requests == 0u || options.repetitions == 0) {
+        throw std::invalid_argument("--requests and --repetitions must be positive");
+    }
+    return options;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    nlohmann::json baseline;
+    try {
+        options = parse_options(argc, argv);
+        if (!options.baseline.empty()) {
+            std::ifstream in(options.baseline);
+            if (!in) {
+                throw std::runtime_error("cannot open baseline " + options.baseline);
+            }
+            baseline = nlohmann::json::parse(in);
+            if (!options.requests && baseline.contains("requests")) {
+                options.requests = baseline["requests"].get<uint64_t>();
+            }
+            if (!options.tolerance && baseline.contains("tolerance")) {
+                options.tolerance = baseline["tolerance"].get<double>();
+            }
+        }
+        options.requests = options.requests.value_or(200000);
+        options.tolerance = options.tolerance.value_or(0.25);
+    } catch (const std::exception& e) {
+        std::cerr << "memsim_perf_regression: " << e.what() << "\n";
+        return 2;
+    }
+
+    std::map<std::string, Measurement> results;
+    std::cout << std::left << std::setw(30) << "Workload"
+              << std::right << std::setw(16) << "cycles/s" << std::setw(16) << "requests/s" << "\n";
+    for (Fidelity fidelity : kFidelities) {
+        for (Pattern pattern : kPatterns) {
+            std::string key = workload_key(fidelity, pattern);
+            Measurement m = measure(fidelity, pattern, options);
+            results[key] = m;
+            std::cout << std::left << std::setw(30) << key << std::right
+                      << std::setw(16) << std::scientific << std::setprecision(3) << m.cycles_per_sec()
+                      << std::setw(16) << m.requests_per_sec() << "\n";
+        }
+    }
+
+    std::cout << "\nSpeedup over cycle-accurate (requests/s, geometric mean):\n"
+              << std::fixed << std::setprecision(1)
+              << "  behavioral:    " << speedup(results, Fidelity::BEHAVIORAL) << "x\n"
+              << "  transactional: " << speedup(results, Fidelity::TRANSACTIONAL) << "x\n";
+
+    if (!options.write_baseline.empty()) {
+        std::ofstream out(options.write_baseline);
+        out << to_json(results, options).dump(2) << "\n";
+        std::cout << "\nBaseline written to " << options.write_baseline << "\n";
+    }
+
+    if (!baseline.is_null()) {
+        if (!compare(results, baseline, *options.tolerance, options.speedup_only)) {
+            std::cout << "\nPerformance regression detected\n";
+            return 1;
+        }
+    }
+    return 0;
+}
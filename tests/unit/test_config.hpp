@@ -0,0 +1,12 @@
+#pragma once
+
+#include <sw/memsim/core/timing.hpp>
+
+/// LPDDR5-6400 controller configuration shared by the unit tests
+inline sw::memsim::ControllerConfig lpddr5_config(sw::memsim::Fidelity fidelity) {
+    sw::memsim::ControllerConfig config;
+    config.technology = sw::memsim::Technology::LPDDR5;
+    config.fidelity = fidelity;
+    config.timing = sw::memsim::timing_presets::lpddr5_6400();
+    return config;
+}
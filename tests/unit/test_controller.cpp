@@ -0,0 +1,753 @@
+#include <catch2/catch_test_macros.hpp>
+#include <sw/memsim/memsim.hpp>
+#include <sw/memsim/technology/lpddr5/lpddr5_controller.hpp>
+#include <sw/memsim/technology/lpddr5/sampling_controller.hpp>
+#include "test_config.hpp"
+
+#include <limits>
+#include <stdexcept>
+
+using namespace sw::memsim;
+
+namespace {
+
+ControllerConfig cycle_accurate_config() {
+    return lpddr5_config(Fidelity::CYCLE_ACCURATE);
+}
+
+/// Submit single-burst reads, ticking whenever the controller back-pressures
+void submit_reads(IMemoryController& controller, const std::vector<Address>& addresses) {
+    const uint32_t burst = controller.config().organization.burst_bytes();
+    for (Address addr : addresses) {
+        while (!controller.read(addr, burst)) {
+            controller.tick();
+        }
+    }
+    controller.drain();
+}
+
+std::vector<Address> same_row_stream(size_t count) {
+    std::vector<Address> addrs;
+    for (size_t i = 0; i < count; ++i) {
+        addrs.push_back((i % 16) * 64);  // Bank 0, row 0
+    }
+    return addrs;
+}
+
+std::vector<Address> row_thrash_stream(size_t count) {
+    std::vector<Address> addrs;
+    for (size_t i = 0; i < count; ++i) {
+        addrs.push_back((i % 8) << 14);  // Bank 0, alternating rows
+    }
+    return addrs;
+}
+
+} // namespace
+
+TEST_CASE("Cycle-accurate controller completes all requests", "[controller]") {
+    lpddr5::CycleAccurateLPDDR5Controller controller(cycle_accurate_config());
+
+    unsigned completed = 0;
+    for (int i = 0; i < 100; ++i) {
+        while (!controller.read(static_cast<Address>(i) * 64, 64,
+                                [&completed](Cycle) { completed++; })) {
+            controller.tick();
+        }
+    }
+    controller.drain();
+
+    REQUIRE(completed == 100);
+    REQUIRE(controller.stats().reads == 100);
+    REQUIRE_FALSE(controller.has_pending());
+}
+
+TEST_CASE("Split requests count once while pending", "[controller][split]") {
+    lpddr5::CycleAccurateLPDDR5Controller controller(cycle_accurate_config());
+    const uint32_t burst = controller.config().organization.burst_bytes();
+
+    REQUIRE(controller.read(0, 4 * burst));
+    REQUIRE(controller.pending_count() == 1);
+    REQUIRE(controller.read(0x100000, burst));
+    REQUIRE(controller.pending_count() == 2);
+
+    controller.drain();
+    REQUIRE(controller.pending_count() == 0);
+}
+
+TEST_CASE("Cycle-accurate controller scales past 256 banks", "[controller][organization]") {
+    auto config = cycle_accurate_config();
+    config.organization.num_channels = 16;
+    config.organization.bank_groups_per_rank = 8;
+    config.organization.banks_per_bank_group = 4;
+    config.page_policy = PagePolicy::OPEN;
+    lpddr5::CycleAccurateLPDDR5Controller controller(config);
+    REQUIRE(controller.config().organization.total_banks() == 512);
+
+    // Column 10 bits, bank 5 bits, row 16 bits, then channel
+    const Address last_bank = (Address{15} << 31) | (Address{7} << 15) | (Address{31} << 10);
+    const Request decoded = controller.decode(last_bank);
+    REQUIRE(decoded.channel == 15);
+    REQUIRE(decoded.bank == 31);
+    REQUIRE(decoded.row == 7);
+    REQUIRE(decoded.bank_index == 511);
+
+    unsigned completed = 0;
+    controller.read(last_bank, 64, [&completed](Cycle) { completed++; });
+    controller.read(Address{3} << 31, 64, [&completed](Cycle) { completed++; });
+    controller.drain();
+    for (int i = 0; i < 40; ++i) {
+        controller.tick();
+    }
+
+    REQUIRE(completed == 2);
+    REQUIRE(controller.open_row(15, 31) == Row{7});
+    REQUIRE(controller.open_row(3, 0) == Row{0});
+    REQUIRE_FALSE(controller.open_row(0, 31).has_value());
+    REQUIRE_FALSE(controller.open_row(0, 0).has_value());
+}
+
+TEST_CASE("Channels with more than 256 banks are addressable", "[controller][organization]") {
+    auto config = cycle_accurate_config();
+    config.organization.num_channels = 2;
+    config.organization.ranks_per_channel = 4;
+    config.organization.bank_groups_per_rank = 8;
+    config.organization.banks_per_bank_group = 16;
+    lpddr5::CycleAccurateLPDDR5Controller controller(config);
+    REQUIRE(controller.banks_per_channel() == 512);
+
+    // Column 10 bits, bank 7 bits, rank 2 bits, row 16 bits, then channel
+    Request last;
+    last.address = (Address{1} << 35) | (Address{5} << 19) | (Address{3} << 17) | (Address{127} << 10);
+    controller.warm(last);
+    REQUIRE(controller.open_row(1, 511) == Row{5});
+    REQUIRE_FALSE(controller.open_row(1, 512).has_value());
+    REQUIRE_FALSE(controller.open_row(0, 511).has_value());
+
+    config.organization.banks_per_bank_group = 64;
+    REQUIRE_THROWS_AS(lpddr5::CycleAccurateLPDDR5Controller(config), std::invalid_argument);
+}
+
+TEST_CASE("Bank array completes transient states at their expiry", "[controller][bank]") {
+    using lpddr5::LPDDR5BankArray;
+    LPDDR5BankArray banks(64);
+    REQUIRE(banks.next_expiry() == LPDDR5BankArray::kNever);
+
+    banks.open_row[3] = 42;
+    banks.enter(3, BankState::ACTIVATING, 10);
+    banks.open_row[7] = 9;
+    banks.auto_precharge[7] = 1;
+    banks.precharge_until[7] = 30;
+    banks.enter(7, BankState::READING, 12);
+    banks.enter(60, BankState::REFRESHING, 50);
+    REQUIRE(banks.next_expiry() == 10);
+
+    banks.update(9);
+    REQUIRE(banks.state_of(3) == BankState::ACTIVATING);
+
+    banks.update(12);
+    REQUIRE(banks.state_of(3) == BankState::ACTIVE);
+    REQUIRE(banks.open_row[3] == 42);
+    REQUIRE(banks.state_of(7) == BankState::PRECHARGING);
+    REQUIRE(banks.state_until[7] == 30);
+    REQUIRE(banks.auto_precharge[7] == 0);
+    REQUIRE(banks.next_expiry() == 30);
+
+    banks.update(30);
+    REQUIRE(banks.state_of(7) == BankState::IDLE);
+    REQUIRE(banks.state_of(60) == BankState::REFRESHING);
+
+    banks.update(50);
+    REQUIRE(banks.state_of(60) == BankState::IDLE);
+    REQUIRE(banks.next_expiry() == LPDDR5BankArray::kNever);
+    REQUIRE(banks.is_ready_for(3, RequestType::READ, 50));
+    REQUIRE_FALSE(banks.is_ready_for(7, RequestType::READ, 50));
+}
+
+TEST_CASE("Channels have their own buses and run in parallel", "[controller][organization]") {
+    // Row hits across the banks of every channel: data bus bound
+    auto cycles_for = [](uint16_t channels) {
+        auto config = cycle_accurate_config();
+        config.organization.num_channels = channels;
+        lpddr5::CycleAccurateLPDDR5Controller controller(config);
+        std::vector<Address> addrs;
+        for (Address i = 0; i < 512; ++i) {
+            Address channel = i % channels;
+            Address bank = (i / channels) % 16;
+            Address column = (i / channels / 16) % 16;
+            addrs.push_back((channel << 30) | (bank << 10) | (column * 64));
+        }
+        submit_reads(controller, addrs);
+        REQUIRE(controller.stats().reads == 512);
+        return controller.cycle();
+    };
+
+    const Cycle one = cycles_for(1);
+    const Cycle four = cycles_for(4);
+
+    // One burst per tBurst on a single data bus
+    const auto t = timing_presets::lpddr5_6400();
+    REQUIRE(one >= 512 * t.tBurst);
+    REQUIRE(four * 3 < one);
+}
+
+TEST_CASE("Ranks have their own banks and share the data bus", "[controller][rank]") {
+    auto config = cycle_accurate_config();
+    config.organization.ranks_per_channel = 2;
+    config.page_policy = PagePolicy::OPEN;
+
+    SECTION("Rank bits sit between bank and row") {
+        lpddr5::CycleAccurateLPDDR5Controller controller(config);
+        REQUIRE(controller.banks_per_channel() == 32);
+
+        const Address rank1 = (Address{1} << 14) | (Address{3} << 10);
+        const Request decoded = controller.decode(rank1);
+        REQUIRE(decoded.rank == 1);
+        REQUIRE(decoded.bank == 3);
+        REQUIRE(decoded.bank_index == 19);
+
+        controller.read(rank1, 64);
+        controller.drain();
+        for (int i = 0; i < 40; ++i) {
+            controller.tick();
+        }
+        REQUIRE(controller.open_row(0, 19) == Row{0});
+        REQUIRE_FALSE(controller.open_row(0, 3).has_value());
+    }
+
+    SECTION("Column accesses are batched per rank") {
+        // Row hits alternating between the ranks
+        std::vector<Address> addrs;
+        for (Address i = 0; i < 512; ++i) {
+            addrs.push_back(((i % 2) << 14) | (((i / 2) % 16) << 10) | ((i / 32) % 16) * 64);
+        }
+        lpddr5::CycleAccurateLPDDR5Controller controller(config);
+        submit_reads(controller, addrs);
+
+        REQUIRE(controller.stats().reads == 512);
+        REQUIRE(controller.stats().rank_switches * 2 * config.max_rank_batch > 512);
+        REQUIRE(controller.stats().rank_switches < 512 / 8);
+        REQUIRE(controller.cycle() < 512 * config.timing.tBurst * 5 / 4);
+    }
+
+    SECTION("Batches are bounded so other ranks are not starved") {
+        auto latency_of_rank1 = [&](uint32_t max_batch) {
+            auto bounded = config;
+            bounded.max_rank_batch = max_batch;
+            lpddr5::CycleAccurateLPDDR5Controller controller(bounded);
+            const uint32_t burst = bounded.organization.burst_bytes();
+            for (Address i = 0; i < 31; ++i) {
+                controller.read(((i % 16) << 10) | (i / 16) * burst, burst);
+            }
+            Cycle latency = 0;
+            controller.read(Address{1} << 14, burst, [&](Cycle l) { latency = l; });
+            controller.drain();
+            return latency;
+        };
+
+        REQUIRE(latency_of_rank1(4) * 2 < latency_of_rank1(0));
+    }
+}
+
+TEST_CASE("Ranks refresh in turn when refresh is enabled", "[controller][rank][refresh]") {
+    auto config = cycle_accurate_config();
+    config.organization.ranks_per_channel = 2;
+    config.enable_refresh = true;
+    const auto& t = config.timing;
+    lpddr5::CycleAccurateLPDDR5Controller controller(config);
+
+    while (controller.cycle() <= t.tREFI) {
+        controller.tick();
+    }
+    REQUIRE(controller.stats().refreshes == 1);
+    REQUIRE(controller.bank_state(0, 0) == BankState::REFRESHING);
+    REQUIRE(controller.bank_state(0, 16) == BankState::IDLE);
+
+    // Rank 0 is busy for tRFC, rank 1 serves immediately
+    Cycle blocked = 0;
+    Cycle free = 0;
+    controller.read(0, 64, [&](Cycle l) { blocked = l; });
+    controller.read(Address{1} << 14, 64, [&](Cycle l) { free = l; });
+    controller.drain();
+    REQUIRE(blocked > t.tRFC - 2);
+    REQUIRE(free < t.tRFC / 2);
+
+    // Rows left open by the reads are precharged before REF
+    while (controller.cycle() <= 2 * t.tREFI + t.tRP) {
+        controller.tick();
+    }
+    REQUIRE(controller.stats().refreshes == 3);
+    REQUIRE(controller.stats().refresh_cycles == 3 * t.tRFC);
+}
+
+TEST_CASE("Open page policy keeps rows open for streaming", "[controller][page_policy]") {
+    auto config = cycle_accurate_config();
+    config.page_policy = PagePolicy::OPEN;
+    lpddr5::CycleAccurateLPDDR5Controller controller(config);
+
+    submit_reads(controller, same_row_stream(64));
+
+    REQUIRE(controller.stats().activates == 1);
+    REQUIRE(controller.stats().auto_precharges == 0);
+    REQUIRE(controller.stats().page_hits == 63);
+    REQUIRE(controller.stats().page_empty == 1);
+}
+
+TEST_CASE("Closed page policy auto-precharges every access", "[controller][page_policy]") {
+    auto config = cycle_accurate_config();
+    config.page_policy = PagePolicy::CLOSED;
+    lpddr5::CycleAccurateLPDDR5Controller controller(config);
+
+    submit_reads(controller, same_row_stream(32));
+
+    REQUIRE(controller.stats().auto_precharges == 32);
+    REQUIRE(controller.stats().activates == 32);
+    REQUIRE(controller.stats().page_hits == 0);
+    REQUIRE(controller.stats().page_conflicts == 0);
+}
+
+TEST_CASE("Closed page avoids conflicts on row thrashing", "[controller][page_policy]") {
+    auto open_config = cycle_accurate_config();
+    open_config.page_policy = PagePolicy::OPEN;
+    lpddr5::CycleAccurateLPDDR5Controller open_ctrl(open_config);
+    submit_reads(open_ctrl, row_thrash_stream(64));
+
+    auto closed_config = cycle_accurate_config();
+    closed_config.page_policy = PagePolicy::CLOSED;
+    lpddr5::CycleAccurateLPDDR5Controller closed_ctrl(closed_config);
+    submit_reads(closed_ctrl, row_thrash_stream(64));
+
+    REQUIRE(open_ctrl.stats().page_conflicts > 0);
+    REQUIRE(closed_ctrl.stats().page_conflicts == 0);
+    REQUIRE(closed_ctrl.stats().precharges == 0);
+}
+
+TEST_CASE("Adaptive page policies follow pending row hits", "[controller][page_policy]") {
+    SECTION("Closed-adaptive keeps the row while hits are queued") {
+        auto config = cycle_accurate_config();
+        config.page_policy = PagePolicy::CLOSED_ADAPTIVE;
+        lpddr5::CycleAccurateLPDDR5Controller controller(config);
+        submit_reads(controller, same_row_stream(64));
+
+        REQUIRE(controller.stats().page_hits > 0);
+        REQUIRE(controller.stats().auto_precharges >= 1);
+        REQUIRE(controller.stats().auto_precharges < 64);
+    }
+
+    SECTION("Open-adaptive closes rows when a conflict is waiting") {
+        auto config = cycle_accurate_config();
+        config.page_policy = PagePolicy::OPEN_ADAPTIVE;
+        lpddr5::CycleAccurateLPDDR5Controller controller(config);
+        submit_reads(controller, row_thrash_stream(64));
+
+        REQUIRE(controller.stats().auto_precharges > 0);
+        REQUIRE(controller.stats().page_conflicts == 0);
+    }
+}
+
+TEST_CASE("Row hit streak cap bounds conflicting request latency", "[controller][starvation]") {
+    // One conflicting read behind a long stream of row hits on the same bank
+    auto run = [](uint32_t cap) {
+        auto config = cycle_accurate_config();
+        config.max_row_hit_streak = cap;
+        lpddr5::CycleAccurateLPDDR5Controller controller(config);
+
+        controller.read(0, 64);
+        for (int i = 0; i < 30; ++i) controller.tick();  // Open row 0
+
+        Cycle victim_latency = 0;
+        controller.read(Address{1} << 14, 64, [&](Cycle lat) { victim_latency = lat; });
+        for (int i = 1; i < 24; ++i) {
+            controller.read(static_cast<Address>(i % 16) * 64, 64);
+        }
+        controller.drain();
+        return victim_latency;
+    };
+
+    REQUIRE(run(4) < run(0));
+}
+
+TEST_CASE("Write buffer coalesces writes to the same burst", "[controller][write_buffer]") {
+    auto config = cycle_accurate_config();
+    config.write_buffer.entries = 16;
+    lpddr5::CycleAccurateLPDDR5Controller controller(config);
+
+    // 4 tiles, each written 8 times with partial 8-byte writes
+    for (int pass = 0; pass < 8; ++pass) {
+        for (Address tile = 0; tile < 4; ++tile) {
+            REQUIRE(controller.write(tile * 1024 + pass * 2, 8));
+        }
+    }
+    controller.drain();
+
+    const auto& stats = controller.stats();
+    uint64_t dram_accesses = stats.page_hits + stats.page_empty + stats.page_conflicts;
+    REQUIRE(stats.writes == 32);
+    REQUIRE(stats.write_merges == 28);
+    REQUIRE(dram_accesses == 4);
+}
+
+TEST_CASE("Write buffer forwards reads to pending writes", "[controller][write_buffer]") {
+    auto config = cycle_accurate_config();
+    config.write_buffer.entries = 16;
+    lpddr5::CycleAccurateLPDDR5Controller controller(config);
+
+    controller.write(0x4000, 32);
+
+    Cycle read_latency = 1000;
+    controller.read(0x4000, 32, [&](Cycle lat) { read_latency = lat; });
+    REQUIRE(read_latency == 0);
+    REQUIRE(controller.stats().read_forwards == 1);
+
+    controller.drain();
+    REQUIRE_FALSE(controller.has_pending());
+    REQUIRE(controller.stats().page_empty == 1);
+}
+
+TEST_CASE("Posted writes stay out of min latency and back-pressure admission", "[controller][write_buffer]") {
+    auto config = cycle_accurate_config();
+    config.write_buffer.entries = 4;
+    config.write_buffer.high_watermark = 4;
+    lpddr5::CycleAccurateLPDDR5Controller controller(config);
+
+    for (Address i = 0; i < 4; ++i) {
+        REQUIRE(controller.can_accept());
+        REQUIRE(controller.write(i * 64, 32));
+    }
+    REQUIRE(controller.stats().writes == 4);
+    REQUIRE(controller.stats().min_latency == std::numeric_limits<uint64_t>::max());
+
+    // A full write buffer refuses the next write, so can_accept() must too
+    REQUIRE_FALSE(controller.can_accept());
+    REQUIRE_FALSE(controller.write(0x8000, 32));
+
+    controller.read(0x10000, 32);
+    controller.drain();
+    REQUIRE(controller.can_accept());
+    REQUIRE(controller.stats().min_latency > 0);
+}
+
+TEST_CASE("Write buffer drains under read pressure", "[controller][write_buffer]") {
+    auto config = cycle_accurate_config();
+    config.queue_depth = 8;
+    config.write_buffer.entries = 8;
+    config.write_buffer.high_watermark = 6;
+    config.write_buffer.low_watermark = 2;
+    lpddr5::CycleAccurateLPDDR5Controller controller(config);
+
+    unsigned accepted = 0;
+    for (Address i = 0; i < 200; ++i) {
+        bool ok = (i % 2 == 0)
+            ? controller.write(i * 64, 32).has_value()
+            : controller.read((i + 1000) * 64, 32).has_value();
+        accepted += ok ? 1 : 0;
+        controller.tick();
+    }
+    controller.drain();
+
+    const auto& stats = controller.stats();
+    REQUIRE(stats.total_requests() == accepted);
+    REQUIRE(stats.page_hits + stats.page_empty + stats.page_conflicts == accepted);
+    REQUIRE_FALSE(controller.has_pending());
+}
+
+TEST_CASE("Large requests are split into burst-sized accesses", "[controller][split]") {
+    auto config = cycle_accurate_config();
+    lpddr5::CycleAccurateLPDDR5Controller controller(config);
+    const uint32_t burst = config.organization.burst_bytes();
+
+    Cycle small_latency = 0;
+    controller.read(0x100000, burst, [&](Cycle lat) { small_latency = lat; });
+    controller.drain();
+
+    unsigned completions = 0;
+    Cycle large_latency = 0;
+    controller.read(0, 4096, [&](Cycle lat) { completions++; large_latency = lat; });
+    controller.drain();
+
+    const auto& stats = controller.stats();
+    REQUIRE(completions == 1);
+    REQUIRE(stats.reads == 2);
+    REQUIRE(stats.page_hits + stats.page_empty + stats.page_conflicts == 1 + 4096 / burst);
+    REQUIRE(large_latency >= (4096 / burst - 1) * config.timing.tCCD_S);
+    REQUIRE(large_latency > small_latency);
+}
+
+TEST_CASE("Unaligned requests touch every overlapped burst", "[controller][split]") {
+    auto config = cycle_accurate_config();
+    lpddr5::CycleAccurateLPDDR5Controller controller(config);
+    const uint32_t burst = config.organization.burst_bytes();
+
+    // Straddles a burst boundary: two column accesses
+    controller.write(burst - 4, 8);
+    controller.drain();
+
+    const auto& stats = controller.stats();
+    REQUIRE(stats.writes == 1);
+    REQUIRE(stats.page_hits + stats.page_empty + stats.page_conflicts == 2);
+}
+
+namespace {
+
+/// Mixed traffic: single bursts, multi-burst reads and writes across banks
+void submit_mixed(IMemoryController& controller, unsigned count, Address base) {
+    for (unsigned i = 0; i < count; ++i) {
+        Address addr = base + static_cast<Address>(i) * 1088;
+        bool ok = (i % 3 == 0) ? controller.write(addr, 32).has_value()
+                : (i % 5 == 0) ? controller.read(addr, 256).has_value()
+                               : controller.read(addr, 32).has_value();
+        if (!ok) {
+            controller.tick();
+        }
+    }
+}
+
+void require_same_stats(const Statistics& a, const Statistics& b) {
+    REQUIRE(a.reads == b.reads);
+    REQUIRE(a.writes == b.writes);
+    REQUIRE(a.total_read_latency == b.total_read_latency);
+    REQUIRE(a.total_write_latency == b.total_write_latency);
+    REQUIRE(a.page_hits == b.page_hits);
+    REQUIRE(a.page_conflicts == b.page_conflicts);
+    REQUIRE(a.activates == b.activates);
+    REQUIRE(a.write_merges == b.write_merges);
+}
+
+} // namespace
+
+TEST_CASE("Checkpoint restores a cycle-accurate controller mid-flight", "[controller][checkpoint]") {
+    auto config = cycle_accurate_config();
+    config.write_buffer.entries = 16;
+    config.max_row_hit_streak = 4;
+
+    lpddr5::CycleAccurateLPDDR5Controller original(config);
+    submit_mixed(original, 60, 0);
+    for (int i = 0; i < 50; ++i) {
+        original.tick();
+    }
+    REQUIRE(original.has_pending());
+
+    auto snapshot = original.checkpoint();
+    lpddr5::CycleAccurateLPDDR5Controller restored(config);
+    restored.restore(snapshot);
+
+    REQUIRE(restored.cycle() == original.cycle());
+    REQUIRE(restored.pending_count() == original.pending_count());
+
+    // Both continue identically from the checkpoint
+    submit_mixed(original, 40, 0x200000);
+    submit_mixed(restored, 40, 0x200000);
+    original.drain();
+    restored.drain();
+
+    REQUIRE(restored.cycle() == original.cycle());
+    require_same_stats(restored.stats(), original.stats());
+}
+
+TEST_CASE("Checkpoint preserves transactional RNG state", "[controller][checkpoint]") {
+    auto config = cycle_accurate_config();
+    config.fidelity = Fidelity::TRANSACTIONAL;
+
+    lpddr5::TransactionalLPDDR5Controller original(config);
+    submit_mixed(original, 10, 0);
+    original.tick();
+
+    lpddr5::TransactionalLPDDR5Controller restored(config);
+    restored.restore(original.checkpoint());
+
+    std::vector<Cycle> expected, actual;
+    for (int i = 0; i < 20; ++i) {
+        original.read(i * 64, 32, [&](Cycle lat) { expected.push_back(lat); });
+        restored.read(i * 64, 32, [&](Cycle lat) { actual.push_back(lat); });
+    }
+    original.drain();
+    restored.drain();
+
+    REQUIRE(actual == expected);
+    require_same_stats(restored.stats(), original.stats());
+}
+
+TEST_CASE("Checkpoint rejects mismatched or truncated data", "[controller][checkpoint]") {
+    lpddr5::CycleAccurateLPDDR5Controller controller(cycle_accurate_config());
+    submit_mixed(controller, 10, 0);
+    auto snapshot = controller.checkpoint();
+
+    auto behavioral_config = cycle_accurate_config();
+    behavioral_config.fidelity = Fidelity::BEHAVIORAL;
+    lpddr5::BehavioralLPDDR5Controller behavioral(behavioral_config);
+    REQUIRE_THROWS_AS(behavioral.restore(snapshot), CheckpointError);
+
+    auto larger_config = cycle_accurate_config();
+    larger_config.queue_depth = 64;
+    lpddr5::CycleAccurateLPDDR5Controller larger(larger_config);
+    REQUIRE_THROWS_AS(larger.restore(snapshot), CheckpointError);
+
+    snapshot.resize(snapshot.size() / 2);
+    lpddr5::CycleAccurateLPDDR5Controller fresh(cycle_accurate_config());
+    REQUIRE_THROWS_AS(fresh.restore(snapshot), CheckpointError);
+}
+
+TEST_CASE("Cloned controller continues identically", "[controller][clone]") {
+    auto config = cycle_accurate_config();
+    config.write_buffer.entries = 16;
+
+    lpddr5::CycleAccurateLPDDR5Controller original(config);
+    unsigned completed = 0;
+    for (unsigned i = 0; i < 24; ++i) {
+        original.read(static_cast<Address>(i) * 1088, 32, [&completed](Cycle) { completed++; });
+    }
+    submit_mixed(original, 20, 0x100000);
+    for (int i = 0; i < 30; ++i) {
+        original.tick();
+    }
+    REQUIRE(original.has_pending());
+
+    auto branch = original.clone();
+    REQUIRE(branch != nullptr);
+    REQUIRE(branch->pending_count() == original.pending_count());
+
+    unsigned before = completed;
+    original.drain();
+    branch->drain();
+
+    // Copied callbacks fire once per branch
+    REQUIRE(completed - before == 2 * (24 - before));
+    REQUIRE(branch->cycle() == original.cycle());
+    require_same_stats(branch->stats(), original.stats());
+}
+
+TEST_CASE("Cloned branches evolve independently", "[controller][clone]") {
+    lpddr5::CycleAccurateLPDDR5Controller original(cycle_accurate_config());
+    submit_reads(original, same_row_stream(16));
+
+    auto copy = original.clone();
+    auto& branch = static_cast<lpddr5::CycleAccurateLPDDR5Controller<>&>(*copy);
+    branch.set_page_policy(PagePolicy::CLOSED);
+
+    submit_reads(original, same_row_stream(32));
+    submit_reads(branch, same_row_stream(32));
+
+    REQUIRE(original.stats().auto_precharges == 0);
+    REQUIRE(branch.stats().auto_precharges == 32);
+    REQUIRE(branch.stats().reads == original.stats().reads);
+
+    // Other fidelities clone by value
+    auto config = cycle_accurate_config();
+    config.fidelity = Fidelity::TRANSACTIONAL;
+    lpddr5::TransactionalLPDDR5Controller transactional(config);
+    transactional.read(0, 32);
+    auto transactional_copy = transactional.clone();
+    transactional.drain();
+    REQUIRE(transactional_copy->pending_count() == 1);
+}
+
+TEST_CASE("Factory binds the configured scheduler policy", "[controller][scheduler]") {
+    // Two rows of bank 0, interleaved
+    std::vector<Address> addrs;
+    for (Address i = 0; i < 64; ++i) {
+        addrs.push_back(((i % 2) << 14) + (i / 2 % 16) * 64);
+    }
+
+    uint64_t fifo_hits = 0;
+    uint64_t fr_fcfs_hits = 0;
+    for (auto policy : {SchedulerPolicy::FIFO, SchedulerPolicy::FR_FCFS, SchedulerPolicy::FR_FCFS_GRP}) {
+        auto config = cycle_accurate_config();
+        config.scheduler = policy;
+        auto controller = lpddr5::create_lpddr5_controller(config);
+        REQUIRE(controller->config().scheduler == policy);
+
+        submit_reads(*controller, addrs);
+        REQUIRE(controller->stats().reads == addrs.size());
+        if (policy == SchedulerPolicy::FIFO) fifo_hits = controller->stats().page_hits;
+        if (policy == SchedulerPolicy::FR_FCFS) fr_fcfs_hits = controller->stats().page_hits;
+
+        // Clones and checkpoints keep the instantiation
+        auto branch = controller->clone();
+        REQUIRE(branch->config().scheduler == policy);
+        auto restored = lpddr5::create_lpddr5_controller(config);
+        restored->restore(controller->checkpoint());
+        REQUIRE(restored->cycle() == controller->cycle());
+    }
+    REQUIRE(fr_fcfs_hits > fifo_hits);
+
+    // A snapshot only restores into the policy that wrote it
+    auto fifo_config = cycle_accurate_config();
+    fifo_config.scheduler = SchedulerPolicy::FIFO;
+    lpddr5::CycleAccurateLPDDR5Controller<FifoScheduler> fifo(fifo_config);
+    lpddr5::CycleAccurateLPDDR5Controller fr_fcfs(cycle_accurate_config());
+    REQUIRE_THROWS_AS(fr_fcfs.restore(fifo.checkpoint()), CheckpointError);
+
+    // The instantiation must match the configured policy
+    REQUIRE_THROWS_AS(lpddr5::CycleAccurateLPDDR5Controller<FifoScheduler>(cycle_accurate_config()),
+                      std::invalid_argument);
+    lpddr5::SamplingConfig sampling;
+    REQUIRE_THROWS_AS(lpddr5::SamplingLPDDR5Controller(fifo_config, sampling), std::invalid_argument);
+    auto sampled = lpddr5::create_sampling_lpddr5_controller(fifo_config, sampling);
+    REQUIRE(sampled->config().scheduler == SchedulerPolicy::FIFO);
+
+    auto unimplemented = cycle_accurate_config();
+    unimplemented.scheduler = SchedulerPolicy::QOS_AWARE;
+    REQUIRE_THROWS_AS(lpddr5::create_lpddr5_controller(unimplemented), std::invalid_argument);
+}
+
+namespace {
+
+/// Row-local bursts at random rows: 8 consecutive bursts per visit
+void run_row_bursts(IMemoryController& controller, unsigned count) {
+    uint64_t state = 42;
+    Address base = 0;
+    for (unsigned i = 0; i < count; ++i) {
+        if (i % 8 == 0) {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            base = (state >> 24) & 0x3FFFC00;
+        }
+        while (!controller.read(base + (i % 8) * 32, 32)) {
+            controller.tick();
+        }
+        controller.tick();
+        controller.tick();
+    }
+    controller.drain();
+}
+
+} // namespace
+
+TEST_CASE("Sampling controller estimates detailed metrics", "[controller][sampling]") {
+    auto config = cycle_accurate_config();
+
+    lpddr5::CycleAccurateLPDDR5Controller full(config);
+    run_row_bursts(full, 40000);
+
+    lpddr5::SamplingConfig sampling;
+    sampling.period = 2000;
+    sampling.warmup = 200;
+    sampling.measure = 400;
+    lpddr5::SamplingLPDDR5Controller sampled(config, sampling);
+    run_row_bursts(sampled, 40000);
+
+    auto report = sampled.report();
+    REQUIRE(report.avg_latency.samples == 20);
+    REQUIRE(report.detailed_requests == 20 * 600);
+    REQUIRE(report.functional_requests == 40000 - 20 * 600);
+    REQUIRE(sampled.stats().reads == 40000);
+
+    // Warmed open-row tables keep the hit rate close to the full run
+    REQUIRE(std::abs(report.page_hit_rate.mean - full.stats().page_hit_rate()) < 0.05);
+    REQUIRE(std::abs(report.avg_latency.mean - full.stats().avg_latency()) <
+            std::max(3 * report.avg_latency.ci95, 0.1 * full.stats().avg_latency()));
+    REQUIRE(report.avg_latency.ci95 > 0.0);
+    REQUIRE(report.bytes_per_cycle.mean > 0.0);
+}
+
+TEST_CASE("Sampling controller validates its schedule", "[controller][sampling]") {
+    lpddr5::SamplingConfig sampling;
+    sampling.period = 100;
+    sampling.warmup = 80;
+    sampling.measure = 40;
+    REQUIRE_THROWS_AS(lpddr5::SamplingLPDDR5Controller(cycle_accurate_config(), sampling),
+                      std::invalid_argument);
+
+    auto m = lpddr5::SampledMetric::from({10.0, 12.0, 11.0, 13.0});
+    REQUIRE(m.mean == 11.5);
+    REQUIRE(m.ci95 > 0.0);
+    REQUIRE(m.relative_error() < 0.2);
+}
@@ -0,0 +1,343 @@
+#include <catch2/catch_test_macros.hpp>
+#include <sw/memsim/memsim.hpp>
+#include <sw/memsim/frontend/cache.hpp>
+#include <sw/memsim/frontend/clock_crossing.hpp>
+#include <sw/memsim/frontend/prefetcher.hpp>
+#include <sw/memsim/frontend/read_merger.hpp>
+#include <sw/memsim/technology/lpddr5/lpddr5_controller.hpp>
+#include "test_config.hpp"
+
+using namespace sw::memsim;
+
+namespace {
+
+CacheConfig small_cache() {
+    CacheConfig config;
+    config.size_bytes = 4096;
+    config.ways = 4;
+    config.line_bytes = 64;
+    config.hit_latency = 2;
+    return config;
+}
+
+/// Submit a demand read from a given source, ticking until it is accepted
+void read_from(IMemoryController& controller, uint16_t source, Address address,
+               uint32_t size, unsigned& completed) {
+    Request request;
+    request.address = address;
+    request.size = size;
+    request.type = RequestType::READ;
+    request.source = source;
+    request.callback = [&completed](Cycle) { completed++; };
+    while (!controller.submit(request)) {
+        controller.tick();
+    }
+}
+
+} // namespace
+
+TEST_CASE("Tag array finds lines and picks LRU victims", "[cache]") {
+    TagArray tags(4, 8);
+    for (uint32_t w = 0; w < 8; ++w) {
+        tags.install(1, w, 100 + w * 4, w + 1);
+    }
+
+    REQUIRE(tags.find(1, 100) == 0);
+    REQUIRE(tags.find(1, 128) == 7);
+    REQUIRE(tags.find(1, 132) == -1);
+    REQUIRE(tags.find(2, 100) == -1);
+
+    tags.touch(1, 0, 100);
+    REQUIRE(tags.victim(1) == 1);
+    REQUIRE(tags.victim(2) == 0);  // Invalid ways first
+}
+
+TEST_CASE("Cache hits avoid memory traffic", "[cache]") {
+    CacheController cache(small_cache(),
+        lpddr5::create_lpddr5_controller(lpddr5_config(Fidelity::CYCLE_ACCURATE)));
+
+    Cycle miss_latency = 0;
+    Cycle hit_latency = 0;
+    cache.read(0x1000, 64, [&](Cycle lat) { miss_latency = lat; });
+    cache.drain();
+    cache.read(0x1000, 64, [&](Cycle lat) { hit_latency = lat; });
+    cache.drain();
+
+    REQUIRE(cache.cache_stats().read_misses == 1);
+    REQUIRE(cache.cache_stats().read_hits == 1);
+    REQUIRE(cache.cache_stats().fills == 1);
+    REQUIRE(hit_latency == 2);
+    REQUIRE(miss_latency > hit_latency);
+    REQUIRE(cache.backing().stats().reads == 1);
+    REQUIRE(cache.stats().reads == 2);
+}
+
+TEST_CASE("Cache merges concurrent misses in MSHRs", "[cache]") {
+    CacheController cache(small_cache(),
+        lpddr5::create_lpddr5_controller(lpddr5_config(Fidelity::CYCLE_ACCURATE)));
+
+    unsigned completed = 0;
+    for (int i = 0; i < 4; ++i) {
+        cache.read(0x2000 + i * 8, 8, [&](Cycle) { completed++; });
+    }
+    cache.drain();
+
+    REQUIRE(completed == 4);
+    REQUIRE(cache.cache_stats().fills == 1);
+    REQUIRE(cache.cache_stats().mshr_merges == 3);
+}
+
+TEST_CASE("Write-back cache writes dirty victims on eviction", "[cache]") {
+    auto config = small_cache();  // 16 sets x 4 ways
+    CacheController cache(config,
+        lpddr5::create_lpddr5_controller(lpddr5_config(Fidelity::BEHAVIORAL)));
+
+    // Five lines mapping to set 0 overflow its four ways
+    const Address stride = 64 * config.num_sets();
+    for (Address i = 0; i < 5; ++i) {
+        while (!cache.write(i * stride, 64)) cache.tick();
+    }
+    cache.drain();
+
+    REQUIRE(cache.cache_stats().evictions == 1);
+    REQUIRE(cache.cache_stats().writebacks == 1);
+    REQUIRE(cache.backing().stats().writes == 1);
+
+    cache.flush();
+    cache.drain();
+    REQUIRE(cache.cache_stats().writebacks == 5);
+}
+
+TEST_CASE("Write-through no-allocate cache forwards every write", "[cache]") {
+    auto config = small_cache();
+    config.write_policy = WritePolicy::WRITE_THROUGH;
+    config.allocate_policy = AllocatePolicy::NO_WRITE_ALLOCATE;
+    CacheController cache(config,
+        lpddr5::create_lpddr5_controller(lpddr5_config(Fidelity::BEHAVIORAL)));
+
+    for (int i = 0; i < 8; ++i) {
+        cache.write(0x3000, 16);
+    }
+    cache.drain();
+
+    REQUIRE(cache.cache_stats().write_misses == 8);
+    REQUIRE(cache.cache_stats().fills == 0);
+    REQUIRE(cache.backing().stats().writes == 8);
+}
+
+TEST_CASE("Cache splits multi-line requests", "[cache]") {
+    CacheController cache(small_cache(),
+        lpddr5::create_lpddr5_controller(lpddr5_config(Fidelity::TRANSACTIONAL)));
+
+    unsigned completed = 0;
+    cache.read(0, 1024, [&](Cycle) { completed++; });
+    cache.drain();
+
+    REQUIRE(completed == 1);
+    REQUIRE(cache.cache_stats().read_misses == 16);
+    REQUIRE(cache.stats().reads == 1);
+}
+
+TEST_CASE("Read merger fans out duplicate reads", "[frontend][merge]") {
+    ReadMerger merger(ReadMergeConfig{},
+        lpddr5::create_lpddr5_controller(lpddr5_config(Fidelity::CYCLE_ACCURATE)));
+
+    // Eight cores read the same broadcast weights
+    std::vector<Cycle> latencies;
+    for (int core = 0; core < 8; ++core) {
+        merger.read(0x8000, 32, [&](Cycle lat) { latencies.push_back(lat); });
+        merger.tick();
+    }
+    merger.drain();
+
+    REQUIRE(latencies.size() == 8);
+    REQUIRE(merger.stats().read_merges == 7);
+    REQUIRE(merger.stats().reads == 8);
+    REQUIRE(merger.backing().stats().reads == 1);
+
+    // Later arrivals wait less for the same data
+    REQUIRE(latencies.front() == latencies.back() + 7);
+}
+
+TEST_CASE("Read merger does not merge across writes", "[frontend][merge]") {
+    ReadMerger merger(ReadMergeConfig{},
+        lpddr5::create_lpddr5_controller(lpddr5_config(Fidelity::CYCLE_ACCURATE)));
+
+    merger.read(0x8000, 32);
+    merger.write(0x8000, 32);
+    merger.read(0x8000, 32);
+    merger.read(0x9000, 64);
+    merger.read(0x9000, 32);
+    merger.drain();
+
+    REQUIRE(merger.stats().read_merges == 1);
+    REQUIRE(merger.backing().stats().reads == 3);
+    REQUIRE(merger.stats().total_requests() == 5);
+    REQUIRE(merger.outstanding_lines() == 0);
+}
+
+TEST_CASE("Read merger works over behavioral controllers", "[frontend][merge]") {
+    ReadMerger merger(ReadMergeConfig{},
+        lpddr5::create_lpddr5_controller(lpddr5_config(Fidelity::BEHAVIORAL)));
+
+    unsigned completed = 0;
+    for (int i = 0; i < 4; ++i) {
+        merger.read(0x100, 64, [&](Cycle) { completed++; });
+    }
+    merger.drain();
+
+    // Behavioral reads complete on submit, so there is nothing to merge into
+    REQUIRE(completed == 4);
+    REQUIRE(merger.stats().read_merges == 0);
+}
+
+TEST_CASE("Prefetcher covers a sequential stream", "[frontend][prefetch]") {
+    PrefetchController prefetcher(PrefetchConfig{},
+        lpddr5::create_lpddr5_controller(lpddr5_config(Fidelity::CYCLE_ACCURATE)));
+
+    unsigned completed = 0;
+    for (Address i = 0; i < 64; ++i) {
+        read_from(prefetcher, 0, 0x10000 + i * 64, 64, completed);
+        for (int t = 0; t < 40; ++t) {
+            prefetcher.tick();
+        }
+    }
+    prefetcher.drain();
+
+    const auto& stats = prefetcher.prefetch_stats();
+    REQUIRE(completed == 64);
+    REQUIRE(prefetcher.stats().reads == 64);
+    REQUIRE(stats.demand_reads == 64);
+    REQUIRE(stats.coverage() > 0.9);
+    REQUIRE(stats.accuracy() > 0.9);
+    REQUIRE(stats.useful + stats.unused + prefetcher.prefetch_config().buffer_lines >= stats.issued);
+}
+
+TEST_CASE("Prefetcher detects strides per source", "[frontend][prefetch]") {
+    PrefetchConfig config;
+    config.stream = false;
+    PrefetchController prefetcher(config,
+        lpddr5::create_lpddr5_controller(lpddr5_config(Fidelity::CYCLE_ACCURATE)));
+
+    // Two interleaved strided walks: only separable by source
+    unsigned completed = 0;
+    for (Address i = 0; i < 32; ++i) {
+        read_from(prefetcher, 1, 0x100000 + i * 1024, 32, completed);
+        read_from(prefetcher, 2, 0x800000 + i * 3072, 32, completed);
+        for (int t = 0; t < 60; ++t) {
+            prefetcher.tick();
+        }
+    }
+    prefetcher.drain();
+
+    const auto& stats = prefetcher.prefetch_stats();
+    REQUIRE(completed == 64);
+    REQUIRE(stats.issued > 0);
+    REQUIRE(stats.coverage() > 0.8);
+    REQUIRE(stats.accuracy() > 0.8);
+}
+
+TEST_CASE("Prefetcher stays quiet on random traffic", "[frontend][prefetch]") {
+    PrefetchController prefetcher(PrefetchConfig{},
+        lpddr5::create_lpddr5_controller(lpddr5_config(Fidelity::CYCLE_ACCURATE)));
+
+    unsigned completed = 0;
+    uint64_t state = 12345;
+    for (int i = 0; i < 128; ++i) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        read_from(prefetcher, 0, (state >> 20) & ~Address{63} & 0xFFFFFFF, 32, completed);
+        prefetcher.tick();
+    }
+    prefetcher.drain();
+
+    REQUIRE(completed == 128);
+    REQUIRE(prefetcher.prefetch_stats().issued <= 8);
+}
+
+TEST_CASE("Writes invalidate prefetched lines", "[frontend][prefetch]") {
+    PrefetchController prefetcher(PrefetchConfig{},
+        lpddr5::create_lpddr5_controller(lpddr5_config(Fidelity::CYCLE_ACCURATE)));
+
+    unsigned completed = 0;
+    for (Address i = 0; i < 3; ++i) {
+        read_from(prefetcher, 0, 0x4000 + i * 64, 32, completed);
+    }
+    prefetcher.drain();
+    REQUIRE(prefetcher.prefetch_stats().issued > 0);
+
+    // Line 3 was prefetched; a write makes the buffered copy stale
+    prefetcher.write(0x4000 + 3 * 64, 32);
+    read_from(prefetcher, 0, 0x4000 + 3 * 64, 32, completed);
+    prefetcher.drain();
+
+    REQUIRE(completed == 4);
+    REQUIRE(prefetcher.prefetch_stats().covered == 0);
+    REQUIRE(prefetcher.prefetch_stats().unused >= 1);
+}
+
+TEST_CASE("Reads after a write do not wait on an in-flight prefetch", "[frontend][prefetch]") {
+    PrefetchController prefetcher(PrefetchConfig{},
+        lpddr5::create_lpddr5_controller(lpddr5_config(Fidelity::CYCLE_ACCURATE)));
+
+    unsigned completed = 0;
+    for (Address i = 0; i < 3; ++i) {
+        read_from(prefetcher, 0, 0x4000 + i * 64, 32, completed);
+    }
+    REQUIRE(prefetcher.prefetch_stats().issued > 0);
+
+    // Line 3 is being prefetched; its fill predates the write
+    prefetcher.write(0x4000 + 3 * 64, 32);
+    read_from(prefetcher, 0, 0x4000 + 3 * 64, 32, completed);
+    prefetcher.drain();
+
+    REQUIRE(completed == 4);
+    REQUIRE(prefetcher.prefetch_stats().late == 0);
+    REQUIRE(prefetcher.prefetch_stats().useful == 0);
+}
+
+TEST_CASE("Clock crossing reports timing in requester cycles", "[frontend][clock]") {
+    // 1.2 GHz accelerator on LPDDR5-6400 (3.2 GHz memory clock)
+    const ClockDomain accelerator = ClockDomain::from_mhz(1200);
+
+    SECTION("Memory clock advances 8 cycles per 3 requester cycles") {
+        ClockCrossing crossing(accelerator,
+            lpddr5::create_lpddr5_controller(lpddr5_config(Fidelity::BEHAVIORAL)));
+        REQUIRE(crossing.ratio() == ClockRatio{8, 3});
+
+        crossing.tick();
+        REQUIRE(crossing.memory_cycle() == 2);
+        crossing.tick(2);
+        REQUIRE(crossing.cycle() == 3);
+        REQUIRE(crossing.memory_cycle() == 8);
+        crossing.tick();
+        crossing.tick();
+        REQUIRE(crossing.memory_cycle() == 13);
+
+        crossing.set_cycle(300);
+        REQUIRE(crossing.memory_cycle() == 800);
+        crossing.tick(1);
+        REQUIRE(crossing.memory_cycle() == 802);
+
+        // Fixed 100 memory-cycle latency seen at the next requester edge
+        Cycle latency = 0;
+        crossing.read(0x100, 64, [&](Cycle l) { latency = l; });
+        REQUIRE(latency == 38);  // 100 * 3/8 = 37.5
+    }
+
+    SECTION("Cycle-accurate latencies scale with the clock ratio") {
+        auto direct = lpddr5::create_lpddr5_controller(lpddr5_config(Fidelity::CYCLE_ACCURATE));
+        ClockCrossing crossing(accelerator,
+            lpddr5::create_lpddr5_controller(lpddr5_config(Fidelity::CYCLE_ACCURATE)));
+
+        Cycle memory_latency = 0;
+        Cycle requester_latency = 0;
+        direct->read(0x4000, 64, [&](Cycle l) { memory_latency = l; });
+        crossing.read(0x4000, 64, [&](Cycle l) { requester_latency = l; });
+        direct->drain();
+        crossing.drain();
+
+        REQUIRE(memory_latency > 0);
+        REQUIRE(requester_latency == ClockRatio{3, 8}.ceil(memory_latency));
+        REQUIRE(crossing.stats().total_read_latency == memory_latency);
+    }
+}
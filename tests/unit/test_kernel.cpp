@@ -0,0 +1,160 @@
+#include <catch2/catch_test_macros.hpp>
+#include <sw/memsim/controller/controller_component.hpp>
+#include <sw/memsim/core/event_kernel.hpp>
+#include <sw/memsim/memsim.hpp>
+#include <sw/memsim/technology/lpddr5/lpddr5_controller.hpp>
+#include <sw/memsim/workload/agent.hpp>
+#include "test_config.hpp"
+
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace sw::memsim;
+using namespace sw::memsim::workload;
+
+namespace {
+
+/// Records its wake-ups and asks to be woken again every `period` cycles
+class Ticker : public Component {
+public:
+    Ticker(Cycle period, unsigned wakes) : period_(period), remaining_(wakes) {}
+
+    std::optional<Cycle> wake(Cycle now) override {
+        woken_at.push_back(now);
+        if (--remaining_ == 0) {
+            return std::nullopt;
+        }
+        return now + period_;
+    }
+
+    std::vector<Cycle> woken_at;
+
+private:
+    Cycle period_;
+    unsigned remaining_;
+};
+
+Agent streaming_reader(AgentScheduler& scheduler, Address base, unsigned lines, Cycle think) {
+    for (unsigned i = 0; i < lines; ++i) {
+        co_await scheduler.read(base + Address{i} * 64, 64);
+        co_await scheduler.delay(think);
+    }
+}
+
+} // namespace
+
+TEST_CASE("Event kernel orders events by cycle, then by scheduling", "[kernel]") {
+    EventKernel kernel(64);
+    std::vector<std::pair<Cycle, int>> log;
+    auto record = [&](int tag) { return [&, tag] { log.emplace_back(kernel.now(), tag); }; };
+
+    kernel.schedule_at(5, record(1));
+    kernel.schedule_at(3, record(2));
+    kernel.schedule_at(5, record(3));
+    kernel.schedule_at(1000, record(4));     // beyond the wheel
+    kernel.schedule_at(70, record(5));       // wraps around the wheel
+    kernel.schedule_at(3, [&] {
+        log.emplace_back(kernel.now(), 6);
+        kernel.schedule_in(0, record(7));    // same cycle, after the rest
+    });
+    REQUIRE(kernel.pending_events() == 6);
+    REQUIRE(kernel.next_event() == Cycle{3});
+
+    kernel.run();
+
+    const std::vector<std::pair<Cycle, int>> expected{
+        {3, 2}, {3, 6}, {3, 7}, {5, 1}, {5, 3}, {70, 5}, {1000, 4}};
+    CHECK(log == expected);
+    CHECK(kernel.idle());
+    CHECK(kernel.now() == 1000);
+    CHECK(kernel.events_processed() == 7);
+    CHECK(kernel.active_cycles() == 4);
+
+    SECTION("Scheduling in the past is rejected") {
+        CHECK_THROWS_AS(kernel.schedule_at(999, [] {}), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Event kernel wakes components only when due", "[kernel]") {
+    EventKernel kernel(64);
+    Ticker fast(1, 3);
+    Ticker slow(500, 2);
+    ComponentId fast_id = kernel.add(fast);
+    ComponentId slow_id = kernel.add(slow);
+
+    SECTION("Periodic wake-ups skip idle cycles") {
+        kernel.wake(fast_id, 10);
+        kernel.wake(slow_id, 0);
+        kernel.run();
+        CHECK(fast.woken_at == std::vector<Cycle>{10, 11, 12});
+        CHECK(slow.woken_at == std::vector<Cycle>{0, 500});
+        CHECK(kernel.active_cycles() == 5);
+    }
+
+    SECTION("An earlier wake-up supersedes a later one") {
+        kernel.wake(slow_id, 200);
+        kernel.wake(slow_id, 300);   // ignored: already due earlier
+        CHECK(kernel.next_wake(slow_id) == 200);
+        kernel.wake(slow_id, 100);
+        CHECK(kernel.next_wake(slow_id) == 100);
+        kernel.run();
+        CHECK(slow.woken_at == std::vector<Cycle>{100, 600});
+        CHECK(kernel.events_processed() == 2);
+    }
+
+    SECTION("Removed components are not woken") {
+        kernel.wake(fast_id, 4);
+        kernel.remove(fast_id);
+        kernel.run();
+        CHECK(fast.woken_at.empty());
+    }
+
+    SECTION("run_until stops at the requested cycle") {
+        kernel.wake(slow_id, 0);
+        kernel.run_until(499);
+        CHECK(kernel.now() == 499);
+        CHECK(slow.woken_at == std::vector<Cycle>{0});
+        CHECK(kernel.next_event() == Cycle{500});
+    }
+}
+
+TEST_CASE("Controllers and agents share one event kernel", "[kernel][agent]") {
+    auto config = lpddr5_config(Fidelity::CYCLE_ACCURATE);
+
+    constexpr unsigned kControllers = 8;
+    constexpr unsigned kAgentsPerController = 4;
+    constexpr unsigned kLines = 32;
+
+    EventKernel kernel;
+    std::vector<std::unique_ptr<IMemoryController>> controllers;
+    std::vector<std::unique_ptr<ControllerComponent>> ports;
+    std::vector<std::unique_ptr<AgentScheduler>> schedulers;
+    for (unsigned c = 0; c < kControllers; ++c) {
+        controllers.push_back(lpddr5::create_lpddr5_controller(config));
+        ports.push_back(std::make_unique<ControllerComponent>(kernel, *controllers.back()));
+        schedulers.push_back(std::make_unique<AgentScheduler>(kernel, *ports.back()));
+        for (unsigned a = 0; a < kAgentsPerController; ++a) {
+            // Controllers get progressively lighter traffic
+            schedulers.back()->spawn(streaming_reader(*schedulers.back(), Address{a} << 20, kLines,
+                                                      Cycle{50} * (c + 1)));
+        }
+    }
+
+    kernel.run();
+
+    uint64_t ticks = 0;
+    for (unsigned c = 0; c < kControllers; ++c) {
+        CHECK(schedulers[c]->active_agents() == 0);
+        CHECK(schedulers[c]->accesses_completed() == kAgentsPerController * kLines);
+        CHECK(controllers[c]->stats().reads == kAgentsPerController * kLines);
+        CHECK(controllers[c]->cycle() <= kernel.now());
+        ticks += ports[c]->ticks();
+    }
+    // Every controller's agents finish, and lightly loaded controllers sleep
+    // through most of the run instead of being ticked every cycle
+    CHECK(ports.back()->ticks() < ports.front()->ticks());
+    CHECK(ticks < kernel.now() * kControllers / 2);
+}
@@ -0,0 +1,181 @@
+#include <catch2/catch_test_macros.hpp>
+#include <sw/memsim/adapter/kpu_adapter.hpp>
+#include <sw/memsim/memsim.hpp>
+#include <sw/memsim/technology/lpddr5/lpddr5_controller.hpp>
+#include "test_config.hpp"
+
+#include <map>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+using namespace sw::memsim;
+
+// ============================================================================
+// Stand-in for kpu-sim's memory interface
+// ============================================================================
+
+namespace kpu_standin {
+
+struct MemoryRequest {
+    uint64_t address;
+    uint32_t size;
+    bool is_write;
+    uint64_t tag;
+};
+
+struct MemoryResponse {
+    uint64_t tag;
+    uint64_t cycle;
+};
+
+class IMemoryController {
+public:
+    virtual ~IMemoryController() = default;
+    virtual bool issue(const MemoryRequest& request) = 0;
+    virtual bool response(MemoryResponse& out) = 0;
+    virtual void tick() = 0;
+};
+
+/// Request type whose fields do not follow the default naming
+struct DmaBeat {
+    uint64_t addr;
+    uint32_t bytes;
+    uint8_t direction;  ///< 0 = load, 1 = store
+    uint32_t id;
+};
+
+} // namespace kpu_standin
+
+template <>
+struct sw::memsim::KpuRequestTraits<kpu_standin::DmaBeat> {
+    static Address address(const kpu_standin::DmaBeat& r) { return r.addr; }
+    static uint32_t size(const kpu_standin::DmaBeat& r) { return r.bytes; }
+    static bool is_write(const kpu_standin::DmaBeat& r) { return r.direction == 1; }
+    static uint64_t tag(const kpu_standin::DmaBeat& r) { return r.id; }
+};
+
+namespace {
+
+/// kpu-sim side of the bridge, as an integrator would write it
+template <typename Controller>
+class MemSimMemory final : public kpu_standin::IMemoryController {
+public:
+    MemSimMemory(const ClockDomain& clock, std::unique_ptr<Controller> controller)
+        : memory_(clock, std::move(controller))
+    {}
+
+    bool issue(const kpu_standin::MemoryRequest& request) override { return memory_.submit(request); }
+
+    bool response(kpu_standin::MemoryResponse& out) override {
+        auto completion = memory_.poll();
+        if (!completion) {
+            return false;
+        }
+        out = {completion->tag, completion->cycle};
+        return true;
+    }
+
+    void tick() override { memory_.tick(); }
+
+    KpuAdapter<Controller>& adapter() { return memory_; }
+
+private:
+    KpuAdapter<Controller> memory_;
+};
+
+} // namespace
+
+TEST_CASE("kpu adapter reports fixed latencies in requester cycles", "[kpu]") {
+    KpuAdapter<> adapter(ClockDomain::from_mhz(1200),
+        lpddr5::create_lpddr5_controller(lpddr5_config(Fidelity::BEHAVIORAL)));
+    REQUIRE(adapter.ratio() == ClockRatio{8, 3});
+
+    kpu_standin::MemoryRequest request{0x1000, 64, false, 7};
+    REQUIRE(adapter.submit(request));
+    REQUIRE(adapter.in_flight() == 1);
+
+    // 100 memory cycles = 37.5 accelerator cycles
+    std::vector<KpuCompletion> done;
+    adapter.tick(37);
+    REQUIRE(adapter.poll(done) == 0);
+    adapter.tick();
+    REQUIRE(adapter.poll(done) == 1);
+    REQUIRE(done[0].tag == 7);
+    REQUIRE(done[0].cycle == 38);
+    REQUIRE(done[0].latency == 38);
+    REQUIRE(adapter.memory_cycle() == 101);
+    REQUIRE(adapter.idle());
+}
+
+TEST_CASE("kpu adapter submits batches until back-pressure", "[kpu]") {
+    ControllerConfig config = lpddr5_config(Fidelity::CYCLE_ACCURATE);
+    config.queue_depth = 8;
+    KpuAdapter<> adapter(ClockDomain::from_mhz(1000), lpddr5::create_lpddr5_controller(config));
+
+    std::vector<kpu_standin::DmaBeat> beats;
+    for (uint32_t i = 0; i < 32; ++i) {
+        beats.push_back({Address{i} * 64, 64, static_cast<uint8_t>(i % 4 == 3), i});
+    }
+
+    std::map<uint64_t, KpuCompletion> completions;
+    std::vector<KpuCompletion> polled;
+    size_t next = 0;
+    while (next < beats.size() || !adapter.idle()) {
+        next += adapter.submit(std::span<const kpu_standin::DmaBeat>(beats).subspan(next));
+        adapter.tick();
+        polled.clear();
+        adapter.poll(polled);
+        for (const auto& c : polled) {
+            REQUIRE(c.cycle <= adapter.cycle());
+            completions[c.tag] = c;
+        }
+    }
+
+    REQUIRE(completions.size() == beats.size());
+    REQUIRE(completions[3].is_write);
+    REQUIRE_FALSE(completions[4].is_write);
+    REQUIRE(adapter.controller().stats().writes == 8);
+    REQUIRE(adapter.controller().stats().reads == 24);
+}
+
+TEST_CASE("kpu adapter calls concrete controllers directly", "[kpu]") {
+    using Direct = lpddr5::CycleAccurateLPDDR5Controller<>;
+    const ClockDomain clock = ClockDomain::from_mhz(1200);
+    const ControllerConfig config = lpddr5_config(Fidelity::CYCLE_ACCURATE);
+
+    MemSimMemory<Direct> direct(clock, std::make_unique<Direct>(config));
+    MemSimMemory<IMemoryController> virtual_calls(clock, lpddr5::create_lpddr5_controller(config));
+
+    kpu_standin::IMemoryController* memories[] = {&direct, &virtual_calls};
+    std::vector<std::vector<kpu_standin::MemoryResponse>> responses(2);
+    for (int m = 0; m < 2; ++m) {
+        for (uint64_t i = 0; i < 16; ++i) {
+            REQUIRE(memories[m]->issue({i * 4096, 64, false, i}));
+        }
+        for (int cycle = 0; cycle < 400; ++cycle) {
+            memories[m]->tick();
+            kpu_standin::MemoryResponse response;
+            while (memories[m]->response(response)) {
+                responses[m].push_back(response);
+            }
+        }
+    }
+
+    // Same timing either way
+    REQUIRE(responses[0].size() == 16);
+    REQUIRE(responses[1].size() == 16);
+    for (size_t i = 0; i < 16; ++i) {
+        REQUIRE(responses[0][i].tag == responses[1][i].tag);
+        REQUIRE(responses[0][i].cycle == responses[1][i].cycle);
+    }
+
+    SECTION("Controller must match the adapter's type") {
+        struct Tuned : Direct {
+            using Direct::Direct;
+        };
+        REQUIRE_THROWS_AS(KpuAdapter<Direct>(clock, std::make_unique<Tuned>(config)), std::invalid_argument);
+        REQUIRE_THROWS_AS(KpuAdapter<Direct>(clock, nullptr), std::invalid_argument);
+    }
+}
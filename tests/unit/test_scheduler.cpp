@@ -0,0 +1,273 @@
+#include <catch2/catch_test_macros.hpp>
+#include <sw/memsim/core/pool.hpp>
+#include <sw/memsim/memsim.hpp>
+#include <sw/memsim/scheduler/fifo.hpp>
+#include <sw/memsim/scheduler/fr_fcfs.hpp>
+#include <sw/memsim/scheduler/fr_fcfs_grp.hpp>
+
+#include <deque>
+
+using namespace sw::memsim;
+
+namespace {
+
+Request make_request(RequestId id, Bank bank, Row row, Cycle submit = 0,
+                     RequestType type = RequestType::READ) {
+    Request req;
+    req.id = id;
+    req.bank = bank;
+    req.bank_index = bank;
+    req.row = row;
+    req.type = type;
+    req.submit_cycle = submit;
+    return req;
+}
+
+} // namespace
+
+TEST_CASE("FR-FCFS prefers row hits", "[scheduler]") {
+    SchedulerConfig config;
+    FrFcfsScheduler sched(config);
+
+    std::deque<Request> reqs;
+    reqs.push_back(make_request(1, 0, 5));
+    reqs.push_back(make_request(2, 0, 7));
+    for (auto& r : reqs) sched.store(r);
+
+    REQUIRE(sched.get_next(0, std::nullopt, RequestType::READ)->id == 1);
+    REQUIRE(sched.get_next(0, Row{7}, RequestType::READ)->id == 2);
+    REQUIRE(sched.has_row_hit(0, 5, RequestType::READ) == false);
+}
+
+TEST_CASE("FR-FCFS serves low-priority prefetches after demands", "[scheduler]") {
+    SchedulerConfig config;
+    FrFcfsScheduler sched(config);
+
+    std::deque<Request> reqs;
+    reqs.push_back(make_request(1, 0, 5));
+    reqs.push_back(make_request(2, 0, 7));
+    reqs.push_back(make_request(3, 0, 5));
+    reqs.push_back(make_request(4, 0, 7));
+    reqs[0].priority = Priority::LOW;
+    reqs[1].priority = Priority::LOW;
+    for (auto& r : reqs) sched.store(r);
+
+    // Same hit status: the younger demand wins
+    REQUIRE(sched.get_next(0, std::nullopt, RequestType::READ)->id == 3);
+    REQUIRE(sched.get_next(0, Row{7}, RequestType::READ)->id == 4);
+
+    // A prefetch row hit still beats a demand miss
+    sched.remove(reqs[3]);
+    REQUIRE(sched.get_next(0, Row{7}, RequestType::READ)->id == 2);
+}
+
+TEST_CASE("FR-FCFS-GRP and FIFO serve low-priority prefetches after demands", "[scheduler]") {
+    SchedulerConfig config;
+    FrFcfsGrpScheduler grp(config);
+    FifoScheduler fifo(config);
+
+    std::deque<Request> reqs;
+    reqs.push_back(make_request(1, 0, 5));
+    reqs.push_back(make_request(2, 0, 7));
+    reqs.push_back(make_request(3, 0, 5));
+    reqs.push_back(make_request(4, 0, 7));
+    for (size_t i = 0; i < reqs.size(); ++i) {
+        reqs[i].address = i * 64;
+    }
+    reqs[0].priority = Priority::LOW;
+    reqs[1].priority = Priority::LOW;
+    for (auto& r : reqs) {
+        grp.store(r);
+        fifo.store(r);
+    }
+
+    REQUIRE(fifo.get_next(0, std::nullopt, RequestType::READ)->id == 3);
+    REQUIRE(grp.get_next(0, std::nullopt, RequestType::READ)->id == 3);
+    REQUIRE(grp.get_next(0, Row{7}, RequestType::READ)->id == 4);
+
+    // A prefetch row hit still beats a demand miss
+    grp.remove(reqs[3]);
+    REQUIRE(grp.get_next(0, Row{7}, RequestType::READ)->id == 2);
+
+    // A demand does not pass an older request to the same address
+    reqs[2].address = reqs[0].address;
+    REQUIRE(grp.get_next(0, Row{5}, RequestType::READ)->id == 1);
+}
+
+TEST_CASE("FR-FCFS row hit streak cap", "[scheduler][starvation]") {
+    SchedulerConfig config;
+    config.max_row_hit_streak = 4;
+    FrFcfsScheduler sched(config);
+
+    // A conflicting request arrives first, then a long stream of row hits
+    std::deque<Request> reqs;
+    reqs.push_back(make_request(100, 0, 9));
+    for (RequestId id = 1; id <= 10; ++id) {
+        reqs.push_back(make_request(id, 0, 3));
+    }
+    for (auto& r : reqs) sched.store(r);
+
+    unsigned hits = 0;
+    Request* next = nullptr;
+    while ((next = sched.get_next(0, Row{3}, RequestType::READ))->row == 3) {
+        sched.remove(*next);
+        hits++;
+    }
+
+    REQUIRE(hits == 4);
+    REQUIRE(next->id == 100);
+    REQUIRE(sched.streak_breaks() == 1);
+
+    // Once the other row has been served the streak restarts
+    sched.remove(*next);
+    REQUIRE(sched.get_next(0, Row{3}, RequestType::READ)->row == 3);
+}
+
+TEST_CASE("FR-FCFS streak cap falls back to hits when no other row waits", "[scheduler][starvation]") {
+    SchedulerConfig config;
+    config.max_row_hit_streak = 2;
+    FrFcfsScheduler sched(config);
+
+    std::deque<Request> reqs;
+    for (RequestId id = 1; id <= 5; ++id) {
+        reqs.push_back(make_request(id, 0, 3));
+    }
+    for (auto& r : reqs) sched.store(r);
+
+    for (int i = 0; i < 5; ++i) {
+        Request* next = sched.get_next(0, Row{3}, RequestType::READ);
+        REQUIRE(next != nullptr);
+        sched.remove(*next);
+    }
+    REQUIRE(sched.streak_breaks() == 0);
+}
+
+TEST_CASE("FR-FCFS age threshold forces oldest request", "[scheduler][starvation]") {
+    SchedulerConfig config;
+    config.max_request_age = 100;
+    FrFcfsScheduler sched(config);
+
+    std::deque<Request> reqs;
+    reqs.push_back(make_request(1, 0, 9, 0));
+    reqs.push_back(make_request(2, 0, 3, 10));
+    for (auto& r : reqs) sched.store(r);
+
+    sched.set_cycle(50);
+    REQUIRE(sched.get_next(0, Row{3}, RequestType::READ)->id == 2);
+
+    sched.set_cycle(100);
+    REQUIRE(sched.get_next(0, Row{3}, RequestType::READ)->id == 1);
+    REQUIRE(sched.age_overrides() == 1);
+}
+
+TEST_CASE("FR-FCFS-GRP applies the same starvation limits", "[scheduler][starvation]") {
+    SchedulerConfig config;
+    config.max_row_hit_streak = 2;
+    config.max_request_age = 1000;
+    FrFcfsGrpScheduler sched(config);
+
+    std::deque<Request> reqs;
+    reqs.push_back(make_request(100, 0, 9));
+    for (RequestId id = 1; id <= 4; ++id) {
+        reqs.push_back(make_request(id, 0, 3));
+    }
+    for (auto& r : reqs) sched.store(r);
+
+    sched.remove(*sched.get_next(0, Row{3}, RequestType::READ));
+    sched.remove(*sched.get_next(0, Row{3}, RequestType::READ));
+    REQUIRE(sched.get_next(0, Row{3}, RequestType::READ)->id == 100);
+
+    sched.set_cycle(1000);
+    REQUIRE(sched.age_overrides() == 0);
+    REQUIRE(sched.get_next(0, Row{3}, RequestType::READ)->id == 100);
+    REQUIRE(sched.age_overrides() == 1);
+}
+
+TEST_CASE("FIFO serves demands in arrival order", "[scheduler]") {
+    SchedulerConfig config;
+    FifoScheduler sched(config);
+
+    std::deque<Request> reqs;
+    reqs.push_back(make_request(1, 0, 9));
+    reqs.push_back(make_request(2, 0, 3));
+    for (auto& r : reqs) sched.store(r);
+
+    REQUIRE(sched.get_next(0, Row{3}, RequestType::READ)->id == 1);
+}
+
+TEST_CASE("FR-FCFS streak cap holds while the bank is precharged", "[scheduler][starvation]") {
+    SchedulerConfig config;
+    config.max_row_hit_streak = 2;
+    FrFcfsScheduler sched(config);
+
+    std::deque<Request> reqs;
+    for (RequestId id = 1; id <= 4; ++id) {
+        reqs.push_back(make_request(id, 0, 3));
+    }
+    reqs.push_back(make_request(100, 0, 9));
+    for (auto& r : reqs) sched.store(r);
+
+    for (int i = 0; i < 2; ++i) {
+        sched.remove(*sched.get_next(0, Row{3}, RequestType::READ));
+    }
+
+    // The capped row must not be picked again once the bank has closed
+    REQUIRE(sched.get_next(0, Row{3}, RequestType::READ)->id == 100);
+    REQUIRE(sched.get_next(0, std::nullopt, RequestType::READ)->id == 100);
+}
+
+TEST_CASE("Scheduler restore rejects corrupt request references", "[scheduler][checkpoint]") {
+    SchedulerConfig config;
+    config.num_banks = 2;
+    Pool<Request> pool(4);
+    FrFcfsScheduler sched(config);
+    Request* first = pool.acquire(make_request(1, 0, 5));
+    Request* second = pool.acquire(make_request(2, 1, 7));
+    sched.store(*first);
+    sched.store(*second);
+
+    CheckpointWriter out;
+    sched.save_state(out, [&](const Request* r) { return static_cast<uint32_t>(pool.index_of(r)); });
+    auto data = out.take();
+
+    SECTION("A consistent pool restores") {
+        FrFcfsScheduler restored(config);
+        CheckpointReader in(data);
+        restored.restore_state(in, [&](uint32_t idx) { return pool.checked_at(idx); });
+        REQUIRE(restored.occupancy() == 2);
+        REQUIRE(restored.get_next(1, std::nullopt, RequestType::READ) == second);
+    }
+
+    SECTION("A slot that is no longer live is rejected") {
+        pool.release(second);
+        FrFcfsScheduler restored(config);
+        CheckpointReader in(data);
+        REQUIRE_THROWS_AS(
+            restored.restore_state(in, [&](uint32_t idx) { return pool.checked_at(idx); }),
+            CheckpointError);
+    }
+
+    SECTION("A request buffered under the wrong bank is rejected") {
+        first->bank_index = 1;
+        FrFcfsScheduler restored(config);
+        CheckpointReader in(data);
+        REQUIRE_THROWS_AS(
+            restored.restore_state(in, [&](uint32_t idx) { return pool.checked_at(idx); }),
+            CheckpointError);
+    }
+}
+
+TEST_CASE("Pool restore rejects corrupt free lists", "[scheduler][checkpoint]") {
+    CheckpointWriter out;
+    out.write<uint64_t>(4);
+    out.write_vector(std::vector<uint32_t>{0, 0, 1});    // slot 0 listed twice
+    out.write<uint32_t>(3);
+    out.write<uint32_t>(7);
+    auto data = out.take();
+
+    Pool<uint32_t> restored(4);
+    CheckpointReader in(data);
+    REQUIRE_THROWS_AS(
+        restored.restore(in, [](CheckpointReader& r) { return r.read<uint32_t>(); }),
+        CheckpointError);
+}
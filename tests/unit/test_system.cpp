@@ -0,0 +1,250 @@
+#include <catch2/catch_test_macros.hpp>
+#include <sw/memsim/memsim.hpp>
+#include <sw/memsim/system/interconnect.hpp>
+#include <sw/memsim/system/memory_system.hpp>
+#include <sw/memsim/technology/lpddr5/lpddr5_controller.hpp>
+#include "test_config.hpp"
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace sw::memsim;
+
+namespace {
+
+constexpr Address kGiB = Address{1} << 30;
+
+/// Two interleaved cycle-accurate controllers below 1 GiB, a behavioral
+/// one (standing in for a slower technology) above
+AddressMap heterogeneous_map() {
+    AddressMap map;
+    map.add({0, kGiB, {0, 1}, 4096});
+    map.add({kGiB, kGiB / 4, {2}, 4096});
+    return map;
+}
+
+std::unique_ptr<MemorySystem> heterogeneous_system() {
+    std::vector<std::unique_ptr<IMemoryController>> controllers;
+    controllers.push_back(lpddr5::create_lpddr5_controller(lpddr5_config(Fidelity::CYCLE_ACCURATE)));
+    controllers.push_back(lpddr5::create_lpddr5_controller(lpddr5_config(Fidelity::CYCLE_ACCURATE)));
+    controllers.push_back(lpddr5::create_lpddr5_controller(lpddr5_config(Fidelity::BEHAVIORAL)));
+    return std::make_unique<MemorySystem>(std::move(controllers), heterogeneous_map());
+}
+
+/// Two controllers, one per chiplet; behavioral ones have a fixed
+/// 100-cycle latency
+std::unique_ptr<Interconnect> two_chiplets(const LinkConfig& d2d,
+                                           Fidelity fidelity = Fidelity::BEHAVIORAL) {
+    std::vector<std::unique_ptr<IMemoryController>> controllers;
+    controllers.push_back(lpddr5::create_lpddr5_controller(lpddr5_config(fidelity)));
+    controllers.push_back(lpddr5::create_lpddr5_controller(lpddr5_config(fidelity)));
+    AddressMap map;
+    map.add({0, kGiB, {0}, 4096});
+    map.add({kGiB, kGiB, {1}, 4096});
+
+    auto noc = std::make_unique<Interconnect>(
+        std::make_unique<MemorySystem>(std::move(controllers), std::move(map)));
+    // Source 0 sits on chiplet 0, source 1 on chiplet 1
+    uint32_t link = noc->add_link(d2d);
+    noc->route(0, 1, link);
+    noc->route(1, 0, link);
+    return noc;
+}
+
+Request read_from(uint16_t source, Address address, Cycle& latency) {
+    Request request;
+    request.address = address;
+    request.size = 64;
+    request.source = source;
+    request.callback = [&latency](Cycle l) { latency = l; };
+    return request;
+}
+
+} // namespace
+
+TEST_CASE("Address map interleaves regions across controllers", "[system]") {
+    AddressMap map = heterogeneous_map();
+
+    SECTION("Granules alternate and pack into local space") {
+        auto first = map.route(0x0040);
+        REQUIRE(first->controller == 0);
+        REQUIRE(first->local == 0x0040);
+
+        auto second = map.route(0x1040);
+        REQUIRE(second->controller == 1);
+        REQUIRE(second->local == 0x0040);
+
+        auto third = map.route(0x2010);
+        REQUIRE(third->controller == 0);
+        REQUIRE(third->local == 0x1010);
+
+        auto linear = map.route(kGiB + 0x12345);
+        REQUIRE(linear->controller == 2);
+        REQUIRE(linear->local == 0x12345);
+
+        REQUIRE(map.footprint(0) == kGiB / 2);
+        REQUIRE(map.footprint(2) == kGiB / 4);
+    }
+
+    SECTION("A controller backing two regions gets disjoint local ranges") {
+        map.add({2 * kGiB, 8192, {2, 0}, 4096});
+        REQUIRE(map.route(2 * kGiB)->controller == 2);
+        REQUIRE(map.route(2 * kGiB)->local == kGiB / 4);
+        REQUIRE(map.route(2 * kGiB + 4096)->controller == 0);
+        REQUIRE(map.route(2 * kGiB + 4096)->local == kGiB / 2);
+    }
+
+    SECTION("Unmapped addresses and invalid regions") {
+        REQUIRE_FALSE(map.route(kGiB + kGiB / 4));
+        REQUIRE_THROWS_AS(map.add({kGiB / 2, 4096, {0}, 4096}), std::invalid_argument);
+        REQUIRE_THROWS_AS(map.add({4 * kGiB, 4096, {0}, 3000}), std::invalid_argument);
+        REQUIRE_THROWS_AS(map.add({4 * kGiB, 4096, {}, 4096}), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Memory system routes requests and merges statistics", "[system]") {
+    auto system = heterogeneous_system();
+    REQUIRE(system->num_controllers() == 3);
+    REQUIRE(system->num_channels() == 3 * system->controller(0).num_channels());
+    REQUIRE(system->channel_base(2) == 2 * system->controller(0).num_channels());
+
+    unsigned completed = 0;
+    auto count = [&](Cycle) { completed++; };
+    for (Address a = 0; a < 16 * 4096; a += 256) {
+        while (!system->read(a, 64, count)) {
+            system->tick();
+        }
+    }
+    for (Address a = kGiB; a < kGiB + 4096; a += 64) {
+        system->write(a, 64, count);
+    }
+    system->drain();
+
+    REQUIRE(completed == 256 + 64);
+    REQUIRE(system->controller(0).stats().reads == 128);
+    REQUIRE(system->controller(1).stats().reads == 128);
+    REQUIRE(system->controller(2).stats().writes == 64);
+    REQUIRE(system->stats().reads == 256);
+    REQUIRE(system->stats().writes == 64);
+    REQUIRE(system->controller(0).cycle() == system->cycle());
+
+    REQUIRE_THROWS_AS(system->read(kGiB + kGiB / 4, 64), std::invalid_argument);
+
+    SECTION("Global channels map onto controller banks") {
+        system->reset();
+        system->read(0x1000, 64);   // controller 1
+        for (int i = 0; i < 40; ++i) {
+            system->tick();
+        }
+        const Channel channel = system->channel_base(1);
+        bool open = false;
+        for (Bank b = 0; b < system->banks_per_channel(); ++b) {
+            open |= system->open_row(channel, b).has_value();
+            REQUIRE_FALSE(system->open_row(0, b).has_value());
+        }
+        REQUIRE(open);
+        REQUIRE_THROWS_AS(system->open_row(system->num_channels(), 0), std::invalid_argument);
+        REQUIRE_THROWS_AS(system->bank_state(system->num_channels() + 5, 0), std::invalid_argument);
+    }
+
+    SECTION("Checkpoints cover every controller") {
+        auto data = system->checkpoint();
+        auto restored = heterogeneous_system();
+        restored->restore(data);
+        REQUIRE(restored->cycle() == system->cycle());
+        REQUIRE(restored->stats().reads == 256);
+        REQUIRE(restored->controller(2).stats().writes == 64);
+    }
+}
+
+TEST_CASE("Interconnect adds link latency and serialization to far accesses", "[system][noc]") {
+    LinkConfig d2d;
+    d2d.latency = 20;
+    d2d.bytes_per_cycle = 32;
+    d2d.header_bytes = 16;
+    auto noc = two_chiplets(d2d);
+
+    Cycle near = 0;
+    Cycle far = 0;
+    REQUIRE(noc->submit(read_from(0, 0x1000, near)));
+    REQUIRE(noc->submit(read_from(0, kGiB + 0x1000, far)));
+    noc->drain();
+
+    // Near: memory only. Far: 1 cycle header + 20 flight, 100 memory,
+    // 3 cycles header + data + 20 flight
+    REQUIRE(near == 100);
+    REQUIRE(far == 144);
+    REQUIRE(noc->link_stats(0).requests == 1);
+    REQUIRE(noc->link_stats(0).request_bytes == 16);
+    REQUIRE(noc->link_stats(0).response_bytes == 80);
+}
+
+TEST_CASE("Interconnect counts memory latency once for deferred completions", "[system][noc]") {
+    // An ideal link: no flight time or headers, a 64-byte response in one cycle
+    LinkConfig ideal;
+    ideal.latency = 0;
+    ideal.header_bytes = 0;
+    ideal.bytes_per_cycle = 1024;
+
+    for (Fidelity fidelity : {Fidelity::TRANSACTIONAL, Fidelity::CYCLE_ACCURATE}) {
+        auto noc = two_chiplets(ideal, fidelity);
+        Cycle far = 0;
+        REQUIRE(noc->submit(read_from(0, kGiB + 0x1000, far)));
+        noc->drain();
+
+        // Memory latency, plus one cycle to hand the request over and one
+        // to return the data
+        const Cycle memory = noc->stats().total_read_latency;
+        REQUIRE(memory > 0);
+        REQUIRE(far == memory + 2);
+    }
+}
+
+TEST_CASE("Interconnect credits and bandwidth throttle far traffic", "[system][noc]") {
+    LinkConfig d2d;
+    d2d.latency = 10;
+    d2d.bytes_per_cycle = 16;
+    d2d.credits = 4;
+    auto noc = two_chiplets(d2d);
+
+    SECTION("Credits bound the requests in flight on a link") {
+        std::vector<Cycle> latencies(6);
+        for (size_t i = 0; i < 4; ++i) {
+            REQUIRE(noc->submit(read_from(1, 64 * i, latencies[i])));
+        }
+        REQUIRE(noc->credits_available(0) == 0);
+        REQUIRE_FALSE(noc->submit(read_from(1, 256, latencies[4])));
+        REQUIRE(noc->link_stats(0).credit_stalls == 1);
+
+        // Local traffic is unaffected
+        REQUIRE(noc->submit(read_from(0, 512, latencies[5])));
+
+        noc->drain();
+        REQUIRE(noc->credits_available(0) == 4);
+        REQUIRE(latencies[5] == 100);
+        REQUIRE(latencies[3] > latencies[0]);
+    }
+
+    SECTION("Write data is limited by link bandwidth") {
+        unsigned completed = 0;
+        Cycle last = 0;
+        for (Address a = 0; a < 64 * 64; a += 64) {
+            Request write;
+            write.address = kGiB + a;
+            write.size = 64;
+            write.type = RequestType::WRITE;
+            write.callback = [&](Cycle) { completed++; last = noc->cycle(); };
+            while (!noc->submit(write)) {
+                noc->tick();
+            }
+        }
+        noc->drain();
+
+        // 80 bytes per write at 16 bytes/cycle
+        REQUIRE(completed == 64);
+        REQUIRE(last >= 64 * 5);
+        REQUIRE(noc->link_stats(0).request_busy_cycles == 64 * 5);
+        REQUIRE(noc->link_stats(0).request_utilization(noc->cycle()) > 0.7);
+    }
+}
@@ -1,6 +1,8 @@
 #include <catch2/catch_test_macros.hpp>
 #include <sw/memsim/memsim.hpp>
 
+#include <stdexcept>
+
 using namespace sw::memsim;
 
 TEST_CASE("Fidelity enum to_string", "[types]") {
@@ -67,6 +69,15 @@ TEST_CASE("OrganizationParams derived values", "[timing]") {
 
     REQUIRE(org.banks_per_rank() == 16);
     REQUIRE(org.total_banks() == 32);
+
+    SECTION("Stacks beyond 256 banks") {
+        org.num_channels = 32;          // 16 channels x 2 pseudo-channels
+        org.ranks_per_channel = 2;
+        REQUIRE(org.banks_per_channel() == 32);
+        REQUIRE(org.total_banks() == 1024);
+        REQUIRE(org.flat_bank(0, 1, 0) == 16);
+        REQUIRE(org.flat_bank(31, 1, 15) == 1023);
+    }
 }
 
 TEST_CASE("ControllerConfig clock calculations", "[timing]") {
@@ -75,4 +86,31 @@ TEST_CASE("ControllerConfig clock calculations", "[timing]") {
 
     REQUIRE(config.clock_mhz() == 3200);
     REQUIRE(config.clock_period_ps() == 312);  // ~312.5ps
+    REQUIRE(config.clock().period_ps() == 312.5);
+}
+
+TEST_CASE("Clock domains convert cycles exactly", "[timing][clock]") {
+    ClockDomain memory = ClockDomain::from_mhz(3200);
+    ClockDomain accelerator = ClockDomain::from_mhz(1200);
+
+    REQUIRE(memory.period_num() == 625);
+    REQUIRE(memory.period_den() == 2);
+    REQUIRE(memory.to_ps(3) == 937);
+    REQUIRE(memory.from_ps(1000) == 3);
+    REQUIRE(accelerator.to_ps(1'200'000'000) == 1'000'000'000'000);
+
+    ClockRatio ratio = accelerator.ratio_to(memory);
+    REQUIRE(ratio == ClockRatio{8, 3});
+    REQUIRE(ratio.inverse() == memory.ratio_to(accelerator));
+    REQUIRE(ratio.floor(1) == 2);
+    REQUIRE(ratio.ceil(1) == 3);
+    REQUIRE(ratio.floor(3) == 8);
+    REQUIRE(ratio.ceil(3) == 8);
+
+    // No drift over long runs
+    REQUIRE(ratio.floor(3'000'000'000'000) == 8'000'000'000'000);
+    REQUIRE(ratio.inverse().ceil(8'000'000'000'001) == 3'000'000'000'001);
+
+    REQUIRE(memory.ratio_to(memory).identity());
+    REQUIRE_THROWS_AS(ClockDomain::from_mhz(0), std::invalid_argument);
 }
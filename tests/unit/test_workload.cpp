@@ -0,0 +1,347 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <sw/memsim/memsim.hpp>
+#include <sw/memsim/technology/lpddr5/lpddr5_controller.hpp>
+#include <sw/memsim/workload/agent.hpp>
+#include <sw/memsim/workload/generator.hpp>
+#include <sw/memsim/workload/tensor_operator.hpp>
+#include "test_config.hpp"
+
+#include <map>
+#include <set>
+#include <vector>
+
+using namespace sw::memsim;
+using namespace sw::memsim::workload;
+using Catch::Matchers::WithinAbs;
+
+namespace {
+
+GeneratorConfig small_region(Address footprint, uint32_t size = 64) {
+    GeneratorConfig config;
+    config.base = 0x10000;
+    config.footprint = footprint;
+    config.size = size;
+    return config;
+}
+
+std::vector<Address> addresses(Generator& generator, size_t count) {
+    std::vector<Request> batch(count);
+    generator.fill(batch);
+    std::vector<Address> result;
+    for (const auto& request : batch) {
+        result.push_back(request.address);
+    }
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Sequential and strided generators wrap at the footprint", "[workload]") {
+    SECTION("Sequential") {
+        SequentialGenerator generator(small_region(256));
+        REQUIRE(addresses(generator, 6) ==
+                std::vector<Address>{0x10000, 0x10040, 0x10080, 0x100C0, 0x10000, 0x10040});
+    }
+
+    SECTION("Strided laps cover every slot") {
+        StridedGenerator generator(small_region(512), 128);
+        auto seen = addresses(generator, 8);
+        REQUIRE(seen == std::vector<Address>{0x10000, 0x10080, 0x10100, 0x10180,
+                                             0x10040, 0x100C0, 0x10140, 0x101C0});
+    }
+
+    SECTION("Invalid parameters") {
+        REQUIRE_THROWS_AS(StridedGenerator(small_region(512), 0), std::invalid_argument);
+        REQUIRE_THROWS_AS(SequentialGenerator(small_region(32)), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Random and Zipfian generators are reproducible", "[workload]") {
+    SECTION("Uniform random stays aligned inside the region") {
+        RandomGenerator generator(small_region(1 << 20));
+        auto first = addresses(generator, 1000);
+        for (Address address : first) {
+            REQUIRE(address >= 0x10000);
+            REQUIRE(address < 0x10000 + (1 << 20));
+            REQUIRE(address % 64 == 0);
+        }
+        generator.reset();
+        REQUIRE(addresses(generator, 1000) == first);
+    }
+
+    SECTION("Zipfian concentrates accesses on the hot set") {
+        ZipfianGenerator generator(small_region(1024 * 64), 0.99);
+        std::map<Address, unsigned> counts;
+        for (Address address : addresses(generator, 20000)) {
+            counts[address]++;
+        }
+        // Lowest slot is the most popular; the hottest 10% take most accesses
+        unsigned hot = 0;
+        for (const auto& [address, n] : counts) {
+            REQUIRE(n <= counts[0x10000]);
+            if (address < 0x10000 + 102 * 64) {
+                hot += n;
+            }
+        }
+        REQUIRE(hot > 20000 / 2);
+    }
+}
+
+TEST_CASE("Tensor walks follow tile and im2col order", "[workload]") {
+    SECTION("2D tile walk clips edge tiles") {
+        // 4x6 fp32 matrix in 2x4 tiles: rows of 16 bytes, then 8-byte edge rows
+        TensorShape shape;
+        shape.extent = {1, 4, 6};
+        shape.element_bytes = 4;
+        TileWalkGenerator generator(small_region(64), shape, {1, 2, 4});
+
+        std::vector<Request> batch(6);
+        generator.fill(batch);
+        REQUIRE(batch[0].address == 0x10000);        // (0, 0)
+        REQUIRE(batch[0].size == 16);
+        REQUIRE(batch[1].address == 0x10000 + 24);   // (1, 0)
+        REQUIRE(batch[2].address == 0x10000 + 16);   // (0, 4) edge tile
+        REQUIRE(batch[2].size == 8);
+        REQUIRE(batch[3].address == 0x10000 + 40);   // (1, 4)
+        REQUIRE(batch[4].address == 0x10000 + 48);   // (2, 0)
+        REQUIRE(batch[5].address == 0x10000 + 72);   // (3, 0)
+    }
+
+    SECTION("im2col reads each receptive field per channel") {
+        ConvShape shape;
+        shape.channels = 2;
+        shape.height = 4;
+        shape.width = 4;
+        shape.kernel_h = 3;
+        shape.kernel_w = 3;
+        shape.element_bytes = 4;
+        Im2colGenerator generator(small_region(64), shape);
+
+        // 2x2 outputs x 2 channels x 3 kernel rows of 12 bytes
+        std::vector<Request> batch(24);
+        generator.fill(batch);
+        REQUIRE(batch[0].address == 0x10000);
+        REQUIRE(batch[0].size == 12);
+        REQUIRE(batch[1].address == 0x10000 + 16);         // next kernel row
+        REQUIRE(batch[3].address == 0x10000 + 64);         // channel 1
+        REQUIRE(batch[6].address == 0x10000 + 4);          // output (0, 1)
+        REQUIRE(batch[12].address == 0x10000 + 16);        // output (1, 0)
+        REQUIRE(generator.next().address == 0x10000);      // wraps
+    }
+}
+
+TEST_CASE("Generators apply read ratio and arrival processes", "[workload]") {
+    GeneratorConfig config = small_region(1 << 16);
+    config.read_ratio = 0.7;
+    config.arrival = {ArrivalProcess::POISSON, 4.0};
+    RandomGenerator generator(config);
+
+    std::vector<Request> batch(20000);
+    generator.fill(batch);
+    unsigned reads = 0;
+    for (size_t i = 0; i < batch.size(); ++i) {
+        reads += batch[i].type == RequestType::READ;
+        if (i > 0) {
+            REQUIRE(batch[i].submit_cycle >= batch[i - 1].submit_cycle);
+        }
+    }
+    REQUIRE_THAT(reads / 20000.0, WithinAbs(0.7, 0.02));
+    REQUIRE_THAT(batch.back().submit_cycle / 20000.0, WithinAbs(4.0, 0.2));
+
+    config.arrival = {ArrivalProcess::FIXED, 2.5};
+    SequentialGenerator fixed(config);
+    REQUIRE(fixed.next().submit_cycle == 0);
+    REQUIRE(fixed.next().submit_cycle == 2);
+    REQUIRE(fixed.next().submit_cycle == 5);
+}
+
+TEST_CASE("Stream mix merges in arrival order and drives a controller", "[workload]") {
+    GeneratorConfig fast = small_region(1 << 16);
+    fast.source = 1;
+    fast.arrival = {ArrivalProcess::FIXED, 1.0};
+    GeneratorConfig slow = small_region(1 << 16);
+    slow.base = 0x100000;
+    slow.source = 2;
+    slow.read_ratio = 0.0;
+    slow.arrival = {ArrivalProcess::FIXED, 4.0};
+
+    std::vector<std::unique_ptr<Generator>> streams;
+    streams.push_back(std::make_unique<SequentialGenerator>(fast));
+    streams.push_back(std::make_unique<RandomGenerator>(slow));
+    MixGenerator mix(std::move(streams));
+
+    std::vector<Request> batch(50);
+    mix.fill(batch);
+    std::map<uint16_t, unsigned> per_source;
+    for (size_t i = 0; i < batch.size(); ++i) {
+        per_source[batch[i].source]++;
+        if (i > 0) {
+            REQUIRE(batch[i].submit_cycle >= batch[i - 1].submit_cycle);
+        }
+    }
+    REQUIRE(per_source[1] == 40);
+    REQUIRE(per_source[2] == 10);
+
+    mix.reset();
+    auto config = lpddr5_config(Fidelity::CYCLE_ACCURATE);
+    auto controller = lpddr5::create_lpddr5_controller(config);
+    REQUIRE(drive(*controller, mix, 500) == 500);
+    controller->drain();
+    REQUIRE(controller->stats().total_requests() == 500);
+    REQUIRE(controller->stats().writes == 100);
+    REQUIRE(controller->cycle() >= 400);
+}
+
+TEST_CASE("Tensor operator traffic follows the dataflow", "[workload]") {
+    // 128^3 GEMM in 64^3 tiles: fp16 A/B tiles are 128 lines, fp32 C tiles 256
+    GemmShape gemm{128, 128, 128};
+    Tiling tiling{64, 64, 64, Dataflow::OUTPUT_STATIONARY};
+
+    TensorOperatorGenerator output_stationary(GeneratorConfig{}, gemm, tiling);
+    OperatorTraffic os = output_stationary.pass_traffic();
+    REQUIRE(os.macs == 128 * 128 * 128);
+    REQUIRE(os.read_requests == 8 * 256);       // A and B every step
+    REQUIRE(os.write_requests == 4 * 256);      // each C tile once
+
+    tiling.dataflow = Dataflow::WEIGHT_STATIONARY;
+    TensorOperatorGenerator weight_stationary(GeneratorConfig{}, gemm, tiling);
+    OperatorTraffic ws = weight_stationary.pass_traffic();
+    REQUIRE(ws.read_requests == 4 * 128 + 8 * 128 + 4 * 256);   // B once, A, partial sums
+    REQUIRE(ws.write_requests == 8 * 256);
+    REQUIRE(ws.arithmetic_intensity() < os.arithmetic_intensity());
+
+    // Streaming one pass touches only the operand regions
+    uint64_t requests = os.read_requests + os.write_requests;
+    for (uint64_t i = 0; i < requests; ++i) {
+        Request request = output_stationary.next();
+        REQUIRE(request.address % 64 == 0);
+        if (request.type == RequestType::WRITE) {
+            REQUIRE(request.address >= output_stationary.output_base());
+        } else {
+            REQUIRE(request.address < output_stationary.output_base());
+        }
+    }
+    REQUIRE(output_stationary.passes() == 1);
+
+    REQUIRE_THROWS_AS(TensorOperatorGenerator(GeneratorConfig{}, GemmShape{0, 1, 1}, tiling),
+                      std::invalid_argument);
+}
+
+TEST_CASE("Convolution layers fetch the input tensor without padding", "[workload]") {
+    // 2x8x8 fp32 input (8 lines), 3x3 kernel, 4 output channels, same padding
+    ConvLayer conv;
+    conv.in_channels = 2;
+    conv.height = 8;
+    conv.width = 8;
+    conv.out_channels = 4;
+    conv.kernel_h = 3;
+    conv.kernel_w = 3;
+    conv.padding = 1;
+    REQUIRE(conv.gemm().m == 64);
+    REQUIRE(conv.gemm().k == 18);
+
+    Precision fp32{DataType::FP32, DataType::FP32, DataType::FP32};
+    TensorOperatorGenerator generator(GeneratorConfig{}, conv, Tiling{64, 4, 18}, fp32);
+    OperatorTraffic traffic = generator.pass_traffic();
+    REQUIRE(traffic.read_requests == 8 + 5);    // whole input once, 288 B of weights
+    REQUIRE(traffic.write_requests == 16);      // 4 x 8 x 8 fp32 outputs
+
+    auto config = lpddr5_config(Fidelity::CYCLE_ACCURATE);
+    auto controller = lpddr5::create_lpddr5_controller(config);
+    drive(*controller, generator, 29 * 3);
+    controller->drain();
+    REQUIRE(generator.passes() == 3);
+    REQUIRE(controller->stats().total_requests() == 29 * 3);
+}
+
+namespace {
+
+/// Closed-loop DMA engine: one outstanding read at a time
+Agent dma_engine(AgentScheduler& scheduler, Address base, unsigned lines,
+                 std::vector<Cycle>& latencies) {
+    for (unsigned i = 0; i < lines; ++i) {
+        latencies.push_back(co_await scheduler.read(base + i * 64, 64));
+    }
+}
+
+/// Reads followed by think time
+Agent paced_reader(AgentScheduler& scheduler, unsigned count, Cycle think, Cycle& finished_at) {
+    for (unsigned i = 0; i < count; ++i) {
+        co_await scheduler.read(i * 64, 64);
+        co_await scheduler.delay(think);
+    }
+    finished_at = scheduler.cycle();
+}
+
+Agent single_write(AgentScheduler& scheduler, Address address) {
+    co_await scheduler.write(address, 64);
+}
+
+Agent failing_agent(AgentScheduler& scheduler) {
+    co_await scheduler.delay(5);
+    throw std::runtime_error("agent failure");
+}
+
+} // namespace
+
+TEST_CASE("Coroutine agents drive a cycle-accurate controller", "[workload][agent]") {
+    auto controller = lpddr5::create_lpddr5_controller(lpddr5_config(Fidelity::CYCLE_ACCURATE));
+    AgentScheduler scheduler(*controller);
+
+    // More concurrent agents than the request queue holds
+    constexpr unsigned kAgents = 64;
+    std::vector<std::vector<Cycle>> latencies(kAgents);
+    for (unsigned a = 0; a < kAgents; ++a) {
+        scheduler.spawn(dma_engine(scheduler, Address{a} << 20, 20, latencies[a]));
+    }
+    REQUIRE(scheduler.active_agents() == kAgents);
+    scheduler.run();
+
+    REQUIRE(scheduler.active_agents() == 0);
+    REQUIRE(scheduler.accesses_completed() == kAgents * 20);
+    REQUIRE(controller->stats().reads == kAgents * 20);
+    for (const auto& agent : latencies) {
+        REQUIRE(agent.size() == 20);
+        for (Cycle latency : agent) {
+            REQUIRE(latency > 0);
+        }
+    }
+}
+
+TEST_CASE("Agent delays and fixed latencies advance simulated time", "[workload][agent]") {
+    auto controller = lpddr5::create_lpddr5_controller(lpddr5_config(Fidelity::BEHAVIORAL));
+    const Cycle latency = controller->config().timing.fixed_read_latency;
+    AgentScheduler scheduler(*controller);
+
+    Cycle finished_at = 0;
+    scheduler.spawn(paced_reader(scheduler, 10, 50, finished_at));
+    scheduler.run();
+    REQUIRE(finished_at == 10 * (latency + 50));
+
+    SECTION("run_until stops at the requested cycle") {
+        Cycle unfinished = 0;
+        scheduler.spawn(paced_reader(scheduler, 1000, 50, unfinished));
+        scheduler.run_until(finished_at + 1000);
+        REQUIRE(scheduler.active_agents() == 1);
+        REQUIRE(scheduler.cycle() >= finished_at + 1000);
+        REQUIRE(unfinished == 0);
+    }
+}
+
+TEST_CASE("Agent frames are pooled and errors propagate", "[workload][agent]") {
+    auto controller = lpddr5::create_lpddr5_controller(lpddr5_config(Fidelity::BEHAVIORAL));
+    AgentScheduler scheduler(*controller);
+
+    uint64_t reuses = FramePool::reuses();
+    for (int i = 0; i < 100; ++i) {
+        scheduler.spawn(single_write(scheduler, i * 64));
+        scheduler.run();
+    }
+    REQUIRE(FramePool::reuses() - reuses >= 99);
+    REQUIRE(controller->stats().writes == 100);
+
+    scheduler.spawn(failing_agent(scheduler));
+    REQUIRE_THROWS_AS(scheduler.run(), std::runtime_error);
+    REQUIRE(scheduler.active_agents() == 0);
+}